@@ -150,6 +150,7 @@ list (APPEND MAIN_SOURCE_FILES
   opm/simulators/flow/ValidationFunctions.cpp
   opm/simulators/flow/equil/EquilibrationHelpers.cpp
   opm/simulators/flow/equil/InitStateEquil.cpp
+  opm/simulators/flow/equil/PressureTableCache.cpp
   opm/simulators/linalg/ExtractParallelGridInformationToISTL.cpp
   opm/simulators/linalg/FlexibleSolver1.cpp
   opm/simulators/linalg/FlexibleSolver2.cpp
@@ -460,11 +461,13 @@ list (APPEND TEST_SOURCE_FILES
   tests/models/test_propertysystem.cpp
   tests/models/test_tasklets.cpp
   tests/models/test_tasklets_failure.cpp
+  tests/test_adaptivesetupreuse.cpp
   tests/test_ALQState.cpp
   tests/test_aquifergridutils.cpp
   tests/test_aqantrc_flow_keyword.cpp
   tests/test_blackoil_amg.cpp
   tests/test_blackoilprimaryvariables.cpp
+  tests/test_chebyshevsmoother.cpp
   tests/test_compwell_equations.cpp
   tests/test_compwell_jacobian.cpp
   tests/test_convergenceoutputconfiguration.cpp
@@ -475,6 +478,7 @@ list (APPEND TEST_SOURCE_FILES
   tests/test_equil.cpp
   tests/test_extraconvergenceoutputthread.cpp
   tests/test_extractMatrix.cpp
+  tests/test_flatidmap.cpp
   tests/test_flexiblesolver.cpp
   tests/test_GasSatfuncConsistencyChecks.cpp
   tests/test_gconsump.cpp
@@ -489,6 +493,7 @@ list (APPEND TEST_SOURCE_FILES
   tests/test_linearleastsquares.cpp
   tests/test_LogOutputHelper.cpp
   tests/test_milu.cpp
+  tests/test_mswellhelpers.cpp
   tests/test_multmatrixtransposed.cpp
   tests/test_networkpressure.cpp
   tests/test_nonnc.cpp
@@ -503,6 +508,7 @@ list (APPEND TEST_SOURCE_FILES
   tests/test_privarspacking.cpp
   tests/test_propertytree.cpp
   tests/test_setuppropertytree.cpp
+  tests/test_recyclinggcrsolver.cpp
   tests/test_region_phase_pvaverage.cpp
   tests/test_relpermdiagnostics.cpp
   tests/test_RestartSerialization.cpp
@@ -1087,6 +1093,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/flow/equil/EquilibrationHelpers_impl.hpp
   opm/simulators/flow/equil/InitStateEquil.hpp
   opm/simulators/flow/equil/InitStateEquil_impl.hpp
+  opm/simulators/flow/equil/PressureTableCache.hpp
   opm/simulators/flow/rescoup/ReservoirCouplingEnabled.hpp
   opm/simulators/wells/SegmentState.hpp
   opm/simulators/wells/WellContainer.hpp
@@ -1101,11 +1108,13 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/aquifers/BlackoilAquiferModel_impl.hpp
   opm/simulators/aquifers/SupportsFaceTag.hpp
   opm/simulators/linalg/AbstractISTLSolver.hpp
+  opm/simulators/linalg/AdaptiveSetupReuse.hpp
   opm/simulators/linalg/amgcpr.hh
   opm/simulators/linalg/bicgstabsolver.hh
   opm/simulators/linalg/blacklist.hh
   opm/simulators/linalg/combinedcriterion.hh
   opm/simulators/linalg/convergencecriterion.hh
+  opm/simulators/linalg/ChebyshevSmoother.hpp
   opm/simulators/linalg/DILU.hpp
   opm/simulators/linalg/domesticoverlapfrombcrsmatrix.hh
   opm/simulators/linalg/elementborderlistfromgrid.hh
@@ -1152,6 +1161,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/linalg/OwningBlockPreconditioner.hpp
   opm/simulators/linalg/OwningTwoLevelPreconditioner.hpp
   opm/simulators/linalg/MILU.hpp
+  opm/simulators/linalg/MixedPrecisionPreconditioner.hpp
   opm/simulators/linalg/parallelamgbackend.hh
   opm/simulators/linalg/parallelbasebackend.hh
   opm/simulators/linalg/parallelbicgstabbackend.hh
@@ -1159,6 +1169,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/linalg/ParallelIstlInformation.hpp
   opm/simulators/linalg/ParallelOverlappingILU0.hpp
   opm/simulators/linalg/ParallelRestrictedAdditiveSchwarz.hpp
+  opm/simulators/linalg/PipelinedBiCGSTABSolver.hpp
   opm/simulators/linalg/PreconditionerFactoryGPUIncludeWrapper.hpp
   opm/simulators/linalg/PreconditionerFactory.hpp
   opm/simulators/linalg/PreconditionerFactory_impl.hpp
@@ -1173,6 +1184,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/linalg/PressureSolverPolicy.hpp
   opm/simulators/linalg/PressureTransferPolicy.hpp
   opm/simulators/linalg/PropertyTree.hpp
+  opm/simulators/linalg/RecyclingGCRSolver.hpp
   opm/simulators/linalg/residreductioncriterion.hh
   opm/simulators/linalg/SmallDenseMatrixUtils.hpp
   opm/simulators/linalg/setupPropertyTree.hpp
@@ -1196,8 +1208,10 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/timestepping/gatherConvergenceReport.hpp
   opm/simulators/utils/ComponentName.hpp
   opm/simulators/utils/ComponentName_impl.hpp
+  opm/simulators/utils/AssignMapValues.hpp
   opm/simulators/utils/DeferredLogger.hpp
   opm/simulators/utils/DeferredLoggingErrorHelpers.hpp
+  opm/simulators/utils/FlatIdMap.hpp
   opm/simulators/utils/ParallelEclipseState.hpp
   opm/simulators/utils/ParallelFileMerger.hpp
   opm/simulators/utils/ParallelNLDDPartitioningZoltan.hpp
@@ -451,6 +451,9 @@ protected:
         }
 
         if (wasSwitched_[globalDofIdx]) {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
             ++numPriVarsSwitched_;
         }
         if (bparams_.projectSaturations_) {
@@ -466,8 +469,10 @@ private:
     BlackoilNewtonParams<Scalar> bparams_{};
 
     // keep track of cells where the primary variable meaning has changed
-    // to detect and hinder oscillations
-    std::vector<bool> wasSwitched_{};
+    // to detect and hinder oscillations. Not std::vector<bool>, so that
+    // disjoint sets of cells (e.g. NLDD subdomains) can be updated from
+    // different threads.
+    std::vector<unsigned char> wasSwitched_{};
 };
 
 } // namespace Opm
@@ -1097,7 +1097,9 @@ public:
         ADVectorBlock darcyFlux(0.0);
         const auto& intQuantsIn = model.intensiveQuantities(globI, /*timeIdx*/ 0);
 
-        // Flux term.
+        // Flux term. Each interior face is visited from both of its cells.
+        // The AD flux only has derivatives with respect to the interior cell,
+        // so each visit gives the Jacobian column of one of the two cells.
         {
 #if OPM_IS_INSIDE_HOST_FUNCTION
             OPM_TIMEBLOCK_LOCAL(fluxCalculationForEachCell, Subsystem::Assembly);
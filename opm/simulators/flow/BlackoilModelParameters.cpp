@@ -85,15 +85,19 @@ BlackoilModelParameters<Scalar>::BlackoilModelParameters()
     max_number_of_well_switches_ = Parameters::Get<Parameters::MaximumNumberOfWellSwitches>();
     max_number_of_group_switches_ = Parameters::Get<Parameters::MaximumNumberOfGroupSwitches>();
     use_average_density_ms_wells_ = Parameters::Get<Parameters::UseAverageDensityMsWells>();
+    use_tree_solver_ms_wells_ = Parameters::Get<Parameters::UseTreeSolverMsWells>();
     local_well_solver_control_switching_ = Parameters::Get<Parameters::LocalWellSolveControlSwitching>();
     use_implicit_ipr_ = Parameters::Get<Parameters::UseImplicitIpr>();
     check_group_constraints_inner_well_iterations_ = Parameters::Get<Parameters::CheckGroupConstraintsInnerWellIterations>();
+    threaded_well_assembly_ = Parameters::Get<Parameters::ThreadedWellAssembly>();
     nonlinear_solver_ = Parameters::Get<Parameters::NonlinearSolver>();
     const auto approach = Parameters::Get<Parameters::LocalSolveApproach>();
     if (approach == "jacobi") {
         local_solve_approach_ = DomainSolveApproach::Jacobi;
     } else if (approach == "gauss-seidel") {
         local_solve_approach_ = DomainSolveApproach::GaussSeidel;
+    } else if (approach == "coloured-gauss-seidel") {
+        local_solve_approach_ = DomainSolveApproach::ColouredGaussSeidel;
     } else {
         throw std::runtime_error("Invalid domain solver approach '" + approach + "' specified.");
     }
@@ -104,6 +108,7 @@ BlackoilModelParameters<Scalar>::BlackoilModelParameters()
     newton_max_iter_ = Parameters::Get<Parameters::NewtonMaxIterations>();
     newton_min_iter_ = Parameters::Get<Parameters::NewtonMinIterations>();
     nldd_num_initial_newton_iter_ = Parameters::Get<Parameters::NlddNumInitialNewtonIter>();
+    nldd_local_solve_threads_ = std::max(1, Parameters::Get<Parameters::NlddLocalSolveThreads>());
     nldd_relative_mobility_change_tol_ = Parameters::Get<Parameters::NlddRelativeMobilityChangeTol<Scalar>>();
     num_local_domains_ = Parameters::Get<Parameters::NumLocalDomains>();
     local_domains_partition_imbalance_ = std::max(Scalar{1.0}, Parameters::Get<Parameters::LocalDomainsPartitioningImbalance<Scalar>>());
@@ -257,12 +262,18 @@ void BlackoilModelParameters<Scalar>::registerParameters()
         ("Maximum number of times a group can switch to the same control");
     Parameters::Register<Parameters::UseAverageDensityMsWells>
         ("Approximate segment densitities by averaging over segment and its outlet");
+    Parameters::Register<Parameters::UseTreeSolverMsWells>
+        ("Solve the segment equations of multisegment wells by block elimination "
+         "along the segment tree, falling back to UMFPack for singular blocks");
     Parameters::Register<Parameters::LocalWellSolveControlSwitching>
         ("Allow control switching during local well solutions");
     Parameters::Register<Parameters::UseImplicitIpr>
         ("Compute implict IPR for stability checks and stable solution search");
     Parameters::Register<Parameters::CheckGroupConstraintsInnerWellIterations>
         ("Allow checking of group constraints during inner well iterations");
+    Parameters::Register<Parameters::ThreadedWellAssembly>
+        ("Assemble, locally solve and update the wells using all OpenMP threads. "
+         "Wells that are distributed across processes are still handled one at a time.");
     Parameters::Register<Parameters::NetworkMaxStrictOuterIterations>
         ("Maximum outer iterations in network solver before relaxing tolerance");
     Parameters::Register<Parameters::NetworkMaxOuterIterations>
@@ -279,7 +290,7 @@ void BlackoilModelParameters<Scalar>::registerParameters()
     Parameters::Register<Parameters::NonlinearSolver>
         ("Choose nonlinear solver. Valid choices are newton or nldd.");
     Parameters::Register<Parameters::LocalSolveApproach>
-        ("Choose local solve approach. Valid choices are jacobi and gauss-seidel");
+        ("Choose local solve approach. Valid choices are jacobi, gauss-seidel and coloured-gauss-seidel");
     Parameters::SetDefault<Parameters::NewtonMaxIterations>(20);
     Parameters::Register<Parameters::NewtonMinIterations>
         ("The minimum number of Newton iterations per time step");
@@ -291,6 +302,10 @@ void BlackoilModelParameters<Scalar>::registerParameters()
         ("Set lower than 1.0 to use stricter convergence tolerance for local solves.");
     Parameters::Register<Parameters::NlddNumInitialNewtonIter>
         ("Number of initial global Newton iterations when running the NLDD nonlinear solver.");
+    Parameters::Register<Parameters::NlddLocalSolveThreads>
+        ("Number of threads used to solve non-neighbouring NLDD subdomains concurrently "
+         "with the jacobi and coloured-gauss-seidel local solve approaches. Subdomains "
+         "coupled to wells are still solved one at a time.");
     Parameters::Register<Parameters::NlddRelativeMobilityChangeTol<Scalar>>
         ("Threshold for single cell relative mobility change in the NLDD solver");
     Parameters::Register<Parameters::NumLocalDomains>
@@ -146,9 +146,11 @@ struct RelaxedPressureTolMsw { static constexpr Scalar value = 1e4; };
 struct MaximumNumberOfWellSwitches { static constexpr int value = 3; };
 struct MaximumNumberOfGroupSwitches { static constexpr int value = 3; };
 struct UseAverageDensityMsWells { static constexpr bool value = false; };
+struct UseTreeSolverMsWells { static constexpr bool value = false; };
 struct LocalWellSolveControlSwitching { static constexpr bool value = true; };
 struct UseImplicitIpr { static constexpr bool value = true; };
 struct CheckGroupConstraintsInnerWellIterations { static constexpr bool value = true; };
+struct ThreadedWellAssembly { static constexpr bool value = false; };
 
 // Network solver parameters
 struct NetworkMaxStrictOuterIterations { static constexpr int value = 10; };
@@ -177,6 +179,7 @@ struct LocalToleranceScalingMb { static constexpr Scalar value = 1.0; };
 template<class Scalar>
 struct LocalToleranceScalingCnv { static constexpr Scalar value = 0.1; };
 struct NlddNumInitialNewtonIter { static constexpr int value = 1; };
+struct NlddLocalSolveThreads { static constexpr int value = 1; };
 template<class Scalar>
 struct NlddRelativeMobilityChangeTol { static constexpr Scalar value = 0.1; };
 struct NumLocalDomains { static constexpr int value = 0; };
@@ -334,6 +337,10 @@ public:
     /// Whether to approximate segment densities by averaging over segment and its outlet
     bool use_average_density_ms_wells_;
 
+    /// Whether to solve the segment equations of multisegment wells by block
+    /// elimination along the segment tree instead of UMFPack
+    bool use_tree_solver_ms_wells_;
+
     /// Whether to allow control switching during local well solutions
     bool local_well_solver_control_switching_;
 
@@ -343,6 +350,9 @@ public:
     /// Whether to allow checking/changing to group controls during inner well iterations
     bool check_group_constraints_inner_well_iterations_;
 
+    /// Whether to assemble and update the wells using several threads
+    bool threaded_well_assembly_;
+
     /// Maximum number of iterations in the network solver before relaxing tolerance
     int network_max_strict_outer_iterations_;
 
@@ -392,6 +402,8 @@ public:
     Scalar local_tolerance_scaling_cnv_;
 
     int nldd_num_initial_newton_iter_{1};
+    /// Number of threads used to solve independent subdomains concurrently (Jacobi and coloured Gauss-Seidel)
+    int nldd_local_solve_threads_{1};
     /// Threshold for single cell relative mobility change in NLDD
     Scalar nldd_relative_mobility_change_tol_;
     int num_local_domains_{0};
@@ -149,7 +149,8 @@ struct EclWriteTasklet : public Opm::TaskletInterface
     std::optional<int> timeStepNum_;
     bool isSubStep_;
     double secondsElapsed_;
-    std::vector<Opm::RestartValue> restartValue_;
+    /// \brief Assembles the restart values from the collected data in the output thread
+    std::function<std::vector<Opm::RestartValue>()> makeRestartValue_;
     bool writeDoublePrecision_;
     /// \brief True if there was an EXIT keyword in ACTIONX causing a simulation end
     bool forcedSimulationFinished_;
@@ -163,7 +164,7 @@ struct EclWriteTasklet : public Opm::TaskletInterface
                              std::optional<int> timeStepNum,
                              bool isSubStep,
                              double secondsElapsed,
-                             std::vector<Opm::RestartValue> restartValue,
+                             std::function<std::vector<Opm::RestartValue>()> makeRestartValue,
                              bool writeDoublePrecision,
                              bool forcedSimulationFinished)
         : actionState_(actionState)
@@ -175,7 +176,7 @@ struct EclWriteTasklet : public Opm::TaskletInterface
         , timeStepNum_(timeStepNum)
         , isSubStep_(isSubStep)
         , secondsElapsed_(secondsElapsed)
-        , restartValue_(std::move(restartValue))
+        , makeRestartValue_(std::move(makeRestartValue))
         , writeDoublePrecision_(writeDoublePrecision)
         , forcedSimulationFinished_(forcedSimulationFinished)
     {}
@@ -183,7 +184,8 @@ struct EclWriteTasklet : public Opm::TaskletInterface
     // callback to eclIO serial writeTimeStep method
     void run() override
     {
-        if (this->restartValue_.size() == 1) {
+        auto restartValue = this->makeRestartValue_();
+        if (restartValue.size() == 1) {
             this->eclIO_.writeTimeStep(this->actionState_,
                                        this->wtestState_,
                                        this->summaryState_,
@@ -191,7 +193,7 @@ struct EclWriteTasklet : public Opm::TaskletInterface
                                        this->reportStepNum_,
                                        this->isSubStep_,
                                        this->secondsElapsed_,
-                                       std::move(this->restartValue_.back()),
+                                       std::move(restartValue.back()),
                                        this->writeDoublePrecision_,
                                        this->timeStepNum_,
                                        forcedSimulationFinished_);
@@ -204,7 +206,7 @@ struct EclWriteTasklet : public Opm::TaskletInterface
                                        this->reportStepNum_,
                                        this->isSubStep_,
                                        this->secondsElapsed_,
-                                       std::move(this->restartValue_),
+                                       std::move(restartValue),
                                        this->writeDoublePrecision_,
                                        this->timeStepNum_,
                                        forcedSimulationFinished_);
@@ -932,66 +934,98 @@ doWriteOutput(const int                          reportStepNum,
     const auto isParallel = this->collectOnIORank_.isParallel();
     const bool needsReordering = this->collectOnIORank_.doesNeedReordering();
 
-    RestartValue restartValue {
-        (isParallel || needsReordering)
-        ? this->collectOnIORank_.globalCellData()
-        : std::move(localCellData),
+    const bool useThresholdPressure = eclState_.getSimulationConfig().useThresholdPressure();
 
-        isParallel ? this->collectOnIORank_.globalWellData()
-                   : std::move(localWellData),
-
-        isParallel ? this->collectOnIORank_.globalGroupAndNetworkData()
-                   : std::move(localGroupAndNetworkData),
-
-        isParallel ? this->collectOnIORank_.globalAquiferData()
-                   : std::move(localAquiferData)
-    };
+    // only serial, only CpGrid (for now)
+    const bool splitLevelGrids = !isParallel && !needsReordering &&
+        (this->eclState_.getLgrs().size() > 0) && (this->grid_.maxLevel() > 0);
+
+    // Only snapshot the data on the simulation thread.  The restart value
+    // is assembled from the snapshot alone, which lets the output thread
+    // do it, overlapping with the following time steps.  The collected
+    // cell data is moved out of the collector, which starts from an empty
+    // solution in the next collect() call.
+    auto makeRestartValue =
+        [isSubStep, nextStepSize, isFlowsn, isFloresn, useThresholdPressure,
+         cellData = (isParallel || needsReordering)
+             ? std::move(this->collectOnIORank_.globalCellData())
+             : std::move(localCellData),
+         wellData = isParallel ? this->collectOnIORank_.globalWellData()
+                               : std::move(localWellData),
+         groupAndNetworkData = isParallel ? this->collectOnIORank_.globalGroupAndNetworkData()
+                                          : std::move(localGroupAndNetworkData),
+         aquiferData = isParallel ? this->collectOnIORank_.globalAquiferData()
+                                  : std::move(localAquiferData),
+         thresholdPressure = useThresholdPressure
+             ? thresholdPressure : std::vector<Scalar>{},
+         flowsn_global = isFlowsn && isParallel ? this->collectOnIORank_.globalFlowsn()
+                                                : std::move(flowsn),
+         floresn_global = isFloresn && isParallel ? this->collectOnIORank_.globalFloresn()
+                                                  : std::move(floresn)]() mutable
+    {
+        RestartValue restartValue {
+            std::move(cellData),
+            std::move(wellData),
+            std::move(groupAndNetworkData),
+            std::move(aquiferData)
+        };
 
-    if (eclState_.getSimulationConfig().useThresholdPressure()) {
-        restartValue.addExtra("THRESHPR", UnitSystem::measure::pressure,
-                              thresholdPressure);
-    }
+        if (useThresholdPressure) {
+            restartValue.addExtra("THRESHPR", UnitSystem::measure::pressure,
+                                  thresholdPressure);
+        }
 
-    // Add suggested next timestep to extra data.
-    if (! isSubStep) {
-        restartValue.addExtra("OPMEXTRA", std::vector<double>(1, nextStepSize));
-    }
+        // Add suggested next timestep to extra data.
+        if (! isSubStep) {
+            restartValue.addExtra("OPMEXTRA", std::vector<double>(1, nextStepSize));
+        }
 
-    // Add nnc flows and flores.
-    if (isFlowsn) {
-        const auto flowsn_global = isParallel ? this->collectOnIORank_.globalFlowsn() : std::move(flowsn);
-        for (const auto& flows : flowsn_global) {
-            if (flows.name.empty())
-                continue;
-            if (flows.name == "FLOGASN+") {
-                restartValue.addExtra(flows.name, UnitSystem::measure::gas_surface_rate, flows.values);
-            } else {
-                restartValue.addExtra(flows.name, UnitSystem::measure::liquid_surface_rate, flows.values);
+        // Add nnc flows and flores.
+        if (isFlowsn) {
+            for (const auto& flows : flowsn_global) {
+                if (flows.name.empty())
+                    continue;
+                if (flows.name == "FLOGASN+") {
+                    restartValue.addExtra(flows.name, UnitSystem::measure::gas_surface_rate, flows.values);
+                } else {
+                    restartValue.addExtra(flows.name, UnitSystem::measure::liquid_surface_rate, flows.values);
+                }
             }
         }
-    }
-    if (isFloresn) {
-        const auto floresn_global = isParallel ? this->collectOnIORank_.globalFloresn() : std::move(floresn);
-        for (const auto& flores : floresn_global) {
-            if (flores.name.empty()) {
-                continue;
+        if (isFloresn) {
+            for (const auto& flores : floresn_global) {
+                if (flores.name.empty()) {
+                    continue;
+                }
+                restartValue.addExtra(flores.name, UnitSystem::measure::rate, flores.values);
             }
-            restartValue.addExtra(flores.name, UnitSystem::measure::rate, flores.values);
         }
-    }
 
-    std::vector<Opm::RestartValue> restartValues{};
-    // only serial, only CpGrid (for now)
-    if ( !isParallel && !needsReordering && (this->eclState_.getLgrs().size()>0) && (this->grid_.maxLevel()>0) ) {
+        return restartValue;
+    };
+
+    std::function<std::vector<RestartValue>()> makeRestartValues;
+    if (splitLevelGrids) {
         // Level cells that appear on the leaf grid view get the data::Solution values from there.
         // Other cells (i.e., parent cells that vanished due to refinement) get rubbish values for now.
         // Only data::Solution is restricted to the level grids. Well, GroupAndNetwork, Aquifer are
-        // not modified in this method.
+        // not modified in this method.  This reads the grid, so it stays on the simulation thread.
+        auto restartValue = makeRestartValue();
+        std::vector<RestartValue> restartValues{};
         Opm::Lgr::extractRestartValueLevelGrids<Grid>(this->grid_, restartValue, restartValues);
+        makeRestartValues = [restartValues = std::move(restartValues)]() mutable
+        {
+            return std::move(restartValues);
+        };
     }
     else {
-        restartValues.reserve(1); // minimum size
-        restartValues.push_back(std::move(restartValue)); // no LGRs-> only one restart value
+        makeRestartValues = [makeRestartValue = std::move(makeRestartValue)]() mutable
+        {
+            std::vector<RestartValue> restartValues{};
+            restartValues.reserve(1); // minimum size
+            restartValues.push_back(makeRestartValue()); // no LGRs-> only one restart value
+            return restartValues;
+        };
     }
 
     // make sure that the previous I/O request has been completed
@@ -1009,7 +1043,7 @@ doWriteOutput(const int                          reportStepNum,
         actionState,
         isParallel ? this->collectOnIORank_.globalWellTestState() : std::move(localWTestState),
         summaryState, udqState, *this->eclIO_,
-        reportStepNum, timeStepNum, isSubStep, curTime, std::move(restartValues), doublePrecision,
+        reportStepNum, timeStepNum, isSubStep, curTime, std::move(makeRestartValues), doublePrecision,
         isForcedFinalOutput);
 
     // finally, start a new output writing job
@@ -59,6 +59,8 @@
 
 #include <boost/date_time/posix_time/posix_time.hpp>
 
+#include <cstddef>
+#include <exception>
 #include <limits>
 #include <map>
 #include <memory>
@@ -496,6 +498,11 @@ public:
             // inter-region flow rate values in order to create restart file
             // output.  There's consequently no need to collect those
             // properties on the I/O rank.
+            //
+            // The collection is a blocking collective on all ranks and stays
+            // on the simulation thread.  Only the restart value assembly and
+            // the file writing are done by the output thread, see
+            // EclGenericWriter::doWriteOutput().
 
             this->collectOnIORank_.collect(localCellData,
                                            this->outputModule_->getBlockData(),
@@ -812,8 +819,6 @@ private:
                          isSubStep && !Parameters::Get<Parameters::EnableWriteAllSolutions>(),
                          log, /*isRestart*/ false);
 
-        ElementContext elemCtx(simulator_);
-
         OPM_BEGIN_PARALLEL_TRY_CATCH();
 
         {
@@ -821,12 +826,42 @@ private:
 
             this->outputModule_->prepareDensityAccumulation();
             this->outputModule_->setupExtractors(isSubStep, reportStepNum);
-            for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
-                elemCtx.updatePrimaryStencil(elem);
-                elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
 
-                this->outputModule_->processElement(elemCtx);
-                this->outputModule_->processElementBlockData(elemCtx);
+            // Interior cells come first in the local numbering, so the cell
+            // data is extracted directly from the cached intensive
+            // quantities without setting up an element context per cell.
+            std::exception_ptr failure;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for (int dofIdx = 0; dofIdx < num_interior; ++dofIdx) {
+                try {
+                    const auto& intQuants = *simulator_.model().cachedIntensiveQuantities(dofIdx, /*timeIdx=*/0);
+                    this->outputModule_->processCell(dofIdx, intQuants);
+                }
+                catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(prepare_local_cell_data_failure)
+#endif
+                    if (!failure) {
+                        failure = std::current_exception();
+                    }
+                }
+            }
+            if (failure) {
+                std::rethrow_exception(failure);
+            }
+
+            // Block data may need the full element context, e.g., for
+            // material law parameters, so it is still collected per element.
+            if (this->outputModule_->hasBlockData()) {
+                ElementContext elemCtx(simulator_);
+                for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
+                    elemCtx.updatePrimaryStencil(elem);
+                    elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
+
+                    this->outputModule_->processElementBlockData(elemCtx);
+                }
             }
             this->outputModule_->clearExtractors();
 
@@ -853,12 +888,11 @@ private:
                                    this->simulator_.vanguard().grid().comm());
     }
 
-    void captureLocalFluxData()
+    void registerFluxConnections()
     {
-        OPM_TIMEBLOCK(captureLocalData);
+        OPM_TIMEBLOCK(registerFluxConnections);
 
         const auto& gridView = this->simulator_.vanguard().gridView();
-        const auto timeIdx = 0u;
 
         auto elemCtx = ElementContext { this->simulator_ };
 
@@ -873,16 +907,71 @@ private:
             return this->cartMapper_.cartesianIndex(elemIndex);
         };
 
+        // Register all connections from the stencils alone, and record the
+        // elements which have connections between regions.  Only these
+        // need their fluxes evaluated.
+        for (const auto& elem : elements(gridView, Dune::Partitions::interiorBorder)) {
+            elemCtx.updateStencil(elem);
+
+            const auto firstConnection = this->outputModule_->
+                registerFluxConnections(elemCtx, activeIndex, cartesianIndex);
+
+            if (firstConnection.has_value()) {
+                this->fluxElements_.emplace_back(elem, *firstConnection);
+            }
+        }
+
+        this->fluxConnectionsRegistered_ = true;
+    }
+
+    void captureLocalFluxData()
+    {
+        OPM_TIMEBLOCK(captureLocalData);
+
+        const auto timeIdx = 0u;
+
         this->outputModule_->initializeFluxData();
 
         OPM_BEGIN_PARALLEL_TRY_CATCH();
 
-        for (const auto& elem : elements(gridView, Dune::Partitions::interiorBorder)) {
-            elemCtx.updateStencil(elem);
-            elemCtx.updateIntensiveQuantities(timeIdx);
-            elemCtx.updateExtensiveQuantities(timeIdx);
+        // The grid does not change, so the connections are only registered
+        // on the first call.
+        if (! this->fluxConnectionsRegistered_) {
+            this->registerFluxConnections();
+        }
 
-            this->outputModule_->processFluxes(elemCtx, activeIndex, cartesianIndex);
+        std::exception_ptr failure;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            auto threadElemCtx = ElementContext { this->simulator_ };
+
+#ifdef _OPENMP
+#pragma omp for
+#endif
+            for (std::size_t i = 0; i < this->fluxElements_.size(); ++i) {
+                try {
+                    const auto& [elem, firstConnection] = this->fluxElements_[i];
+
+                    threadElemCtx.updateStencil(elem);
+                    threadElemCtx.updateIntensiveQuantities(timeIdx);
+                    threadElemCtx.updateExtensiveQuantities(timeIdx);
+
+                    this->outputModule_->processFluxes(threadElemCtx, firstConnection);
+                }
+                catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(capture_local_flux_data_failure)
+#endif
+                    if (!failure) {
+                        failure = std::current_exception();
+                    }
+                }
+            }
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
         }
 
         OPM_END_PARALLEL_TRY_CATCH("EclWriter::captureLocalFluxData() failed: ",
@@ -941,6 +1030,11 @@ private:
     Scalar restartTimeStepSize_;
     int rank_ ;
     Inplace inplace_;
+
+    // Elements with connections between regions, and the index of their
+    // first registered flux connection.  See registerFluxConnections().
+    std::vector<std::pair<Element, std::size_t>> fluxElements_{};
+    bool fluxConnectionsRegistered_{false};
 };
 
 } // namespace Opm
@@ -126,7 +126,9 @@ public:
                                  vanguard.gridView(),
                                  vanguard.cartesianMapper(),
                                  simulator.problem().gravity()[dimWorld - 1],
-                                 simulator.problem().numPressurePointsEquil());
+                                 simulator.problem().numPressurePointsEquil(),
+                                 /*applySwatInit=*/true,
+                                 simulator.problem().equilPressureTableCache());
 
         // copy the result into the array of initial fluid states
         initialFluidStates_.resize(numElems);
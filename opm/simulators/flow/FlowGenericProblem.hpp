@@ -270,6 +270,9 @@ public:
     int numPressurePointsEquil() const
     { return numPressurePointsEquil_; }
 
+    const std::string& equilPressureTableCache() const
+    { return equilPressureTableCache_; }
+
     bool operator==(const FlowGenericProblem& rhs) const;
 
     template<class Serializer>
@@ -367,6 +370,7 @@ protected:
 
     // equilibration parameters
     int numPressurePointsEquil_;
+    std::string equilPressureTableCache_;
 
     bool enableDriftCompensation_;
     bool enableDriftCompensationTemp_{false};
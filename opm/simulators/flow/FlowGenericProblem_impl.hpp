@@ -85,6 +85,8 @@ FlowGenericProblem(const EclipseState& eclState,
         ? Parameters::Get<Parameters::NumPressurePointsEquil>()
         : eclState.getTableManager().getEqldims().getNumDepthNodesP();
 
+    equilPressureTableCache_ = Parameters::Get<Parameters::EquilPressureTableCache>();
+
     explicitRockCompaction_ = Parameters::Get<Parameters::ExplicitRockCompaction>();
 }
 
@@ -422,6 +422,9 @@ namespace Opm {
                                      simulator_->model().localAccumulatedReports(),
                                      this->output_cout_,
                                      FlowGenericVanguard::comm());
+                reportNlddColourStatistics(simulator_->model().colourAccumulatedReports(),
+                                           this->output_cout_,
+                                           FlowGenericVanguard::comm());
             }
 
             if (! this->output_cout_) {
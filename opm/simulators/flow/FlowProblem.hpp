@@ -37,6 +37,7 @@
 #include <opm/common/utility/TimeService.hpp>
 
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/Schedule/Action/Actions.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/input/eclipse/Units/Units.hpp>
 
@@ -256,6 +257,17 @@ public:
             this->enableDriftCompensationTemp_ = Parameters::Get<Parameters::EnableDriftCompensationTemp>();
         }
 
+        // Keep the face geometry for the transmissibility updates only if
+        // the schedule or its actions may change the multipliers.
+        const auto& schedule = simulator.vanguard().schedule();
+        for (std::size_t step = 0; step < schedule.size(); ++step) {
+            if (schedule[step].events().hasEvent(ScheduleEvents::GEO_MODIFIER) ||
+                !schedule[step].actions().empty())
+            {
+                transmissibilities_.setKeepFaceTable(true);
+                break;
+            }
+        }
     }
 
     virtual ~FlowProblem() = default;
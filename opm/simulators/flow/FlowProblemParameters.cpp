@@ -62,6 +62,9 @@ void registerFlowProblemParameters()
     Parameters::Register<Parameters::NumPressurePointsEquil>
         ("Number of pressure points (in each direction) in tables used for equilibration");
     Parameters::Hide<Parameters::NumPressurePointsEquil>(); // Users will typically not need to modify this parameter..
+    Parameters::Register<Parameters::EquilPressureTableCache>
+        ("Directory in which the pressure tables used for equilibration are cached "
+         "and reused by later runs with the same fluid model. Disabled if empty");
     Parameters::Register<Parameters::ExplicitRockCompaction>
         ("Use pressure from end of the last time step when evaluating rock compaction");
     Parameters::Hide<Parameters::ExplicitRockCompaction>(); // Users will typically not need to modify this parameter..
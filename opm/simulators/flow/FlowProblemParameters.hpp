@@ -54,6 +54,9 @@ struct NumSatfuncConsistencySamplePoints { static constexpr int value = 5; };
 struct NumPressurePointsEquil
 { static constexpr int value = ParserKeywords::EQLDIMS::DEPTH_NODES_P::defaultValue; };
 
+// Directory of cached equilibration pressure tables, disabled if empty
+struct EquilPressureTableCache { static constexpr auto value = ""; };
+
 struct OutputMode { static constexpr auto value = "all"; };
 
 // The frequency of writing restart (*.ers) files. This is the number of time steps
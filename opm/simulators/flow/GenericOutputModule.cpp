@@ -1018,6 +1018,11 @@ outputErrorLog(const Parallel::Communication& comm) const
         return;
     }
 
+    // Cells may be processed concurrently, so sort them for a
+    // reproducible log.
+    std::ranges::sort(std::get<0>(globalFailedCellsPbub));
+    std::ranges::sort(std::get<0>(globalFailedCellsPdew));
+
     logOutput_.error(std::get<0>(globalFailedCellsPbub),
                      std::get<0>(globalFailedCellsPdew));
 }
@@ -26,8 +26,69 @@
 #include <opm/simulators/flow/InterRegFlows.hpp>
 
 #include <algorithm>
+#include <array>
 #include <stdexcept>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+    int numThreads()
+    {
+#ifdef _OPENMP
+        return omp_get_max_threads();
+#else
+        return 1;
+#endif
+    }
+
+    int threadNum()
+    {
+#ifdef _OPENMP
+        return omp_get_thread_num();
+#else
+        return 0;
+#endif
+    }
+
+    using FlowRates = Opm::data::InterRegFlowMap::FlowRates;
+    using Component = Opm::data::InterRegFlowMap::Component;
+
+    constexpr auto components = std::array {
+        Component::Oil, Component::Gas, Component::Water,
+        Component::Disgas, Component::Vapoil,
+    };
+
+    /// Add flow rates q into sum.
+    ///
+    /// FlowRates only provides mutable element access, whence the
+    /// non-const reference to q.
+    void accumulate(FlowRates& q, FlowRates& sum)
+    {
+        for (const auto component : components) {
+            sum[component] += q[component];
+        }
+    }
+
+    /// Add flow rates q into separate sums of positive and negative rates.
+    ///
+    /// Keeps the directional flows, e.g., for summary vectors like ROFT+
+    /// and ROFT-, intact when accumulating multiple connections.
+    void accumulate(FlowRates& q, FlowRates& positive, FlowRates& negative)
+    {
+        for (const auto component : components) {
+            const auto rate = q[component];
+            if (rate > 0.0) {
+                positive[component] += rate;
+            }
+            else {
+                negative[component] += rate;
+            }
+        }
+    }
+} // Anonymous namespace
+
 Opm::InterRegFlowMapSingleFIP::
 InterRegFlowMapSingleFIP(const std::vector<int>& region)
     : region_(region.size(), 0)
@@ -39,6 +100,8 @@ InterRegFlowMapSingleFIP(const std::vector<int>& region)
 
     std::ranges::transform(region, this->region_.begin(),
                            [](const int regID) { return regID - 1; });
+
+    this->threadRates_.resize(numThreads());
 }
 
 void
@@ -53,35 +116,102 @@ addConnection(const Cell& source,
         };
     }
 
-    if (! source.isInterior ||
-        (source.cartesianIndex > destination.cartesianIndex))
-    {
-        // Connection handled in different call.  Don't double-count
-        // contributions.
+    const auto pair = this->regionPair(source, destination);
+    if (! pair.has_value()) {
         return;
     }
 
-    const auto r1 = this->region_[ source.activeIndex ];
-    const auto r2 = this->region_[ destination.activeIndex ];
+    // Inter-region connection internal to an MPI rank or this rank owns
+    // the flow rate across this connection.
+    this->iregFlow_.addConnection(pair->first, pair->second, rates);
+}
 
-    if (r1 == r2) {
-        // Connection is internal to a region.  Nothing to do.
+bool
+Opm::InterRegFlowMapSingleFIP::
+registerConnection(const Cell& source, const Cell& destination)
+{
+    if (this->isReadFromStream_) {
+        throw std::logic_error {
+            "Cannot register new connection in deserialised object"
+        };
+    }
+
+    const auto pair = this->regionPair(source, destination);
+    if (! pair.has_value()) {
+        this->connectionPair_.push_back(-1);
+        return false;
+    }
+
+    const auto key = static_cast<std::size_t>(pair->first)*this->maxLocalRegionID_
+        + static_cast<std::size_t>(pair->second);
+
+    const auto numPairs = static_cast<int>(this->regionPairs_.size());
+    const auto [pos, inserted] = this->pairIndex_.try_emplace(key, numPairs);
+    if (inserted) {
+        this->regionPairs_.push_back(*pair);
+
+        for (auto& rates : this->threadRates_) {
+            rates.resize(2 * this->regionPairs_.size());
+        }
+    }
+
+    this->connectionPair_.push_back(pos->second);
+    return true;
+}
+
+void
+Opm::InterRegFlowMapSingleFIP::
+addConnection(const std::size_t connection,
+              data::InterRegFlowMap::FlowRates rates)
+{
+    const auto pair = this->connectionPair_[connection];
+    if (pair < 0) {
+        // Connection does not contribute to inter-region flows.
         return;
     }
 
-    // Inter-region connection internal to an MPI rank or this rank owns
-    // the flow rate across this connection.
-    this->iregFlow_.addConnection(r1, r2, rates);
+    auto& threadRates = this->threadRates_[threadNum()];
+    accumulate(rates, threadRates[2*pair + 0], threadRates[2*pair + 1]);
 }
 
 void Opm::InterRegFlowMapSingleFIP::compress()
 {
+    // Reduce per-thread contributions across registered connections.
+    // Region pairs are distinct, so this adds at most one positive and one
+    // negative flow rate contribution per region pair.
+    const auto numPairs = this->regionPairs_.size();
+    for (auto pair = 0*numPairs; pair < numPairs; ++pair) {
+        auto positive = data::InterRegFlowMap::FlowRates{};
+        auto negative = data::InterRegFlowMap::FlowRates{};
+
+        for (auto& threadRates : this->threadRates_) {
+            accumulate(threadRates[2*pair + 0], positive);
+            accumulate(threadRates[2*pair + 1], negative);
+
+            threadRates[2*pair + 0] = data::InterRegFlowMap::FlowRates{};
+            threadRates[2*pair + 1] = data::InterRegFlowMap::FlowRates{};
+        }
+
+        const auto& [r1, r2] = this->regionPairs_[pair];
+        this->iregFlow_.addConnection(r1, r2, positive);
+        this->iregFlow_.addConnection(r1, r2, negative);
+    }
+
     this->iregFlow_.compress(this->maxGlobalRegionID_);
 }
 
 void Opm::InterRegFlowMapSingleFIP::clear()
 {
     this->iregFlow_.clear();
+
+    // Registered connections are kept.  Only reset their accumulated
+    // rates.
+    const auto numRates = 2 * this->regionPairs_.size();
+    this->threadRates_.resize(numThreads());
+    for (auto& rates : this->threadRates_) {
+        rates.assign(numRates, data::InterRegFlowMap::FlowRates{});
+    }
+
     this->isReadFromStream_ = false;
 }
 
@@ -111,6 +241,29 @@ assignGlobalMaxRegionID(const std::size_t regID)
     return true;
 }
 
+std::optional<std::pair<int, int>>
+Opm::InterRegFlowMapSingleFIP::
+regionPair(const Cell& source, const Cell& destination) const
+{
+    if (! source.isInterior ||
+        (source.cartesianIndex > destination.cartesianIndex))
+    {
+        // Connection handled in different call.  Don't double-count
+        // contributions.
+        return std::nullopt;
+    }
+
+    const auto r1 = this->region_[ source.activeIndex ];
+    const auto r2 = this->region_[ destination.activeIndex ];
+
+    if (r1 == r2) {
+        // Connection is internal to a region.  Nothing to do.
+        return std::nullopt;
+    }
+
+    return std::pair { r1, r2 };
+}
+
 // =====================================================================
 //
 // Implementation of EclInterRegFlowMap (wrapper for multiple arrays)
@@ -161,6 +314,39 @@ addConnection(const Cell& source,
     }
 }
 
+bool
+Opm::InterRegFlowMap::
+registerConnection(const Cell& source, const Cell& destination)
+{
+    auto isInterRegion = false;
+
+    for (auto& regionMap : this->regionMaps_) {
+        const auto contributes = regionMap.registerConnection(source, destination);
+        isInterRegion = isInterRegion || contributes;
+    }
+
+    return isInterRegion;
+}
+
+bool
+Opm::InterRegFlowMap::
+isInterRegionConnection(const std::size_t connection) const
+{
+    return std::ranges::any_of(this->regionMaps_,
+                               [connection](const auto& regionMap)
+                               { return regionMap.isInterRegionConnection(connection); });
+}
+
+void
+Opm::InterRegFlowMap::
+addConnection(const std::size_t connection,
+              const data::InterRegFlowMap::FlowRates& rates)
+{
+    for (auto& regionMap : this->regionMaps_) {
+        regionMap.addConnection(connection, rates);
+    }
+}
+
 void Opm::InterRegFlowMap::compress()
 {
     for (auto& regionMap : this->regionMaps_) {
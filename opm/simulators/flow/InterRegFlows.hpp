@@ -26,7 +26,9 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -35,6 +37,12 @@
 /// MPI-aware facility for converting collection of tuples of region ID
 /// pairs and associate flow rates into a sparse (CSR) adjacency matrix
 /// representation of a graph.  Supports O(nnz) compression.
+///
+/// Connections may alternatively be registered up front, once for a given
+/// grid, and their flow rates subsequently added by connection index from
+/// multiple threads.  Such rates are accumulated into dense per-thread
+/// arrays, indexed by distinct region pair, and reduced into the CSR
+/// representation by compress().
 
 namespace Opm {
 
@@ -58,6 +66,10 @@ namespace Opm {
             bool isInterior{true};
         };
 
+        /// Cells on either side of a single connection, in the order
+        /// source, destination.
+        using Connection = std::pair<Cell, Cell>;
+
         friend class InterRegFlowMap;
 
         /// Constructor
@@ -83,6 +95,45 @@ namespace Opm {
                            const Cell& destination,
                            const data::InterRegFlowMap::FlowRates& rates);
 
+        /// Register connection for subsequent, thread-safe, accumulation
+        /// of flow rates by connection index.
+        ///
+        /// Connections are numbered consecutively, starting at zero, in
+        /// the order in which they are registered.  Registered connections
+        /// are kept across calls to clear().  Not thread-safe.
+        ///
+        /// \param[in] source Cell from which the flow nominally originates.
+        ///
+        /// \param[in] destination Cell into which flow nominally goes.
+        ///
+        /// \return Whether or not flow across this connection contributes
+        ///    to the inter-region flows.  Same rules as for
+        ///    addConnection().
+        bool registerConnection(const Cell& source, const Cell& destination);
+
+        /// Whether or not flow across a registered connection contributes
+        /// to the inter-region flows.
+        ///
+        /// \param[in] connection Connection index from a previous call to
+        ///    registerConnection().
+        bool isInterRegionConnection(const std::size_t connection) const
+        {
+            return this->connectionPair_[connection] >= 0;
+        }
+
+        /// Add flow rate across registered connection.
+        ///
+        /// Thread-safe.  Contributions are accumulated into the calling
+        /// thread's buffer and included in the CSR representation by the
+        /// next call to compress().
+        ///
+        /// \param[in] connection Connection index from a previous call to
+        ///    registerConnection().
+        ///
+        /// \param[in] rates Flow rates associated to single connection.
+        void addConnection(const std::size_t connection,
+                           data::InterRegFlowMap::FlowRates rates);
+
         /// Form CSR adjacency matrix representation of input graph from
         /// connections established in previous calls to addConnection().
         ///
@@ -91,6 +142,7 @@ namespace Opm {
         void compress();
 
         /// Clear all internal buffers, but preserve allocated capacity.
+        /// Registered connections are kept, with their flow rates reset.
         void clear();
 
         /// Get read-only access to the underlying CSR representation.
@@ -166,12 +218,37 @@ namespace Opm {
         /// Rank-local inter-regional flow map.
         data::InterRegFlowMap iregFlow_{};
 
+        /// Index into regionPairs_ of each registered connection.  Negative
+        /// for connections which do not contribute to the inter-region
+        /// flows.
+        std::vector<int> connectionPair_{};
+
+        /// Distinct pairs of zero-based region IDs, source region first, of
+        /// all registered connections.
+        std::vector<std::pair<int, int>> regionPairs_{};
+
+        /// Index into regionPairs_ keyed by linearised region pair.
+        std::unordered_map<std::size_t, int> pairIndex_{};
+
+        /// Flow rates accumulated across registered connections.  One
+        /// array for each thread, with separate sums of positive and
+        /// negative rates, in that order, for each region pair.
+        std::vector<std::vector<data::InterRegFlowMap::FlowRates>> threadRates_{};
+
         /// Whether or not this object contains contributions deserialised
         /// from a stream.  For error detection.
         bool isReadFromStream_{false};
 
         /// Default constructor.
         InterRegFlowMapSingleFIP() = default;
+
+        /// Region pair whose flows include those across a connection.
+        ///
+        /// \return Zero-based source and destination region IDs, or
+        ///    nullopt if the connection is internal to a region or if
+        ///    its flow is owned by a different call or MPI rank.
+        std::optional<std::pair<int, int>>
+        regionPair(const Cell& source, const Cell& destination) const;
     };
 
     /// Inter-region flow accumulation maps for all region definition arrays
@@ -192,6 +269,9 @@ namespace Opm {
         /// Characteristics of a cell from a simulation grid.
         using Cell = InterRegFlowMapSingleFIP::Cell;
 
+        /// Cells on either side of a single connection.
+        using Connection = InterRegFlowMapSingleFIP::Connection;
+
         /// Default constructor.
         InterRegFlowMap() = default;
 
@@ -243,6 +323,42 @@ namespace Opm {
                            const Cell& destination,
                            const data::InterRegFlowMap::FlowRates& rates);
 
+        /// Register connection for all region definitions, for subsequent
+        /// thread-safe accumulation of flow rates by connection index.
+        ///
+        /// Connections are numbered consecutively, starting at zero, in
+        /// the order in which they are registered.  Registered connections
+        /// are kept across calls to clear().  Not thread-safe.
+        ///
+        /// \param[in] source Cell from which the flow nominally originates.
+        ///
+        /// \param[in] destination Cell into which flow nominally goes.
+        ///
+        /// \return Whether or not flow across this connection contributes
+        ///    to the inter-region flows of any region definition.
+        bool registerConnection(const Cell& source, const Cell& destination);
+
+        /// Whether or not flow across a registered connection contributes
+        /// to the inter-region flows of any region definition.
+        ///
+        /// \param[in] connection Connection index from a previous call to
+        ///    registerConnection().
+        bool isInterRegionConnection(const std::size_t connection) const;
+
+        /// Add flow rate across registered connection for all region
+        /// definitions.
+        ///
+        /// Thread-safe.  Contributions are accumulated into per-thread
+        /// buffers and included in the CSR representations by the next
+        /// call to compress().
+        ///
+        /// \param[in] connection Connection index from a previous call to
+        ///    registerConnection().
+        ///
+        /// \param[in] rates Flow rates associated to single connection.
+        void addConnection(const std::size_t connection,
+                           const data::InterRegFlowMap::FlowRates& rates);
+
         /// Form CSR adjacency matrix representation of input graph from
         /// connections established in previous calls to addConnection().
         ///
@@ -251,6 +367,7 @@ namespace Opm {
         void compress();
 
         /// Clear all internal buffers, but preserve allocated capacity.
+        /// Registered connections are kept, with their flow rates reset.
         void clear();
 
         /// Names of all applicable region definition arrays.
@@ -28,6 +28,8 @@
 
 #include <fmt/format.h>
 
+#include <iomanip>
+#include <numeric>
 #include <sstream>
 #include <vector>
 
@@ -140,4 +142,42 @@ void reportNlddStatistics(const std::vector<SimulatorReport>& domain_reports,
     }
 }
 
+void reportNlddColourStatistics(const NlddColourReport& colour_report,
+                                const bool output_cout,
+                                const Parallel::Communication& comm)
+{
+    const int solved = std::accumulate(colour_report.solved_domains.begin(),
+                                       colour_report.solved_domains.end(), 0);
+    if (comm.sum(solved) == 0) {
+        return;
+    }
+
+    const auto& mpi_rank = comm.rank();
+    const double total_time = std::accumulate(colour_report.solve_time.begin(),
+                                              colour_report.solve_time.end(), 0.0);
+
+    // Create a deferred logger and add the report with rank as tag
+    DeferredLogger local_log;
+    std::ostringstream ss;
+    ss << "======  Accumulated local solve time per subdomain colour on rank " << mpi_rank << " ======\n"
+       << "  colour   domains   solved domains   solve time (s)   fraction\n";
+    for (std::size_t c = 0; c < colour_report.solve_time.size(); ++c) {
+        const double time = colour_report.solve_time[c];
+        ss << std::setw(8) << c
+           << std::setw(10) << colour_report.num_domains[c]
+           << std::setw(17) << colour_report.solved_domains[c]
+           << std::setw(17) << fmt::format("{:.3f}", time)
+           << std::setw(11) << fmt::format("{:.3f}", total_time > 0.0 ? time / total_time : 0.0)
+           << '\n';
+    }
+    // Use rank number as tag to ensure correct ordering
+    local_log.debug(fmt::format("{:05d}", mpi_rank), ss.str());
+
+    // Gather all logs and output them in sorted order
+    auto global_log = gatherDeferredLogger(local_log, comm);
+    if (output_cout) {
+        global_log.logMessages();
+    }
+}
+
 } // namespace Opm
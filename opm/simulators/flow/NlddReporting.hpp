@@ -77,6 +77,23 @@ void writeNlddFile(const std::string& file,
 
 } // namespace details
 
+/**
+ * Struct holding the accumulated local solve data per subdomain colour.
+*/
+struct NlddColourReport
+{
+    std::vector<int> num_domains; //!< Number of subdomains of each colour
+    std::vector<int> solved_domains; //!< Accumulated number of solved subdomains per colour
+    std::vector<double> solve_time; //!< Accumulated wall time spent solving each colour
+
+    void resize(std::size_t num_colours)
+    {
+        num_domains.resize(num_colours, 0);
+        solved_domains.resize(num_colours, 0);
+        solve_time.resize(num_colours, 0.0);
+    }
+};
+
 /**
  * Reports NLDD statistics after simulation.
  *
@@ -90,6 +107,18 @@ void reportNlddStatistics(const std::vector<SimulatorReport>& domain_reports,
                           const bool output_cout,
                           const Parallel::Communication& comm);
 
+/**
+ * Reports the accumulated solve times per subdomain colour after simulation.
+ * Nothing is reported if the subdomains were never solved colour by colour.
+ *
+ * @param colour_report The accumulated solve data per colour on this rank
+ * @param output_cout Whether to output to cout
+ * @param comm The communication object for parallel runs
+ */
+void reportNlddColourStatistics(const NlddColourReport& colour_report,
+                                const bool output_cout,
+                                const Parallel::Communication& comm);
+
 /**
  * Writes the number of nonlinear iterations per cell to a file in ResInsight compatible format
  *
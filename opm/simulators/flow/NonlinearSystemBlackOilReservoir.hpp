@@ -259,6 +259,9 @@ public:
     /// return the statistics of local solves accumulated for each domain on this rank
     const std::vector<SimulatorReport>& domainAccumulatedReports() const;
 
+    /// return the solve times of the subdomain colours accumulated for this rank
+    const NlddColourReport& colourAccumulatedReports() const;
+
     /// Write the number of nonlinear iterations per cell to a file in ResInsight compatible format
     void writeNonlinearIterationsPerCell(const std::filesystem::path& odir) const;
 
@@ -1082,6 +1082,16 @@ domainAccumulatedReports() const
     return nlddSolver_->domainAccumulatedReports();
 }
 
+template <class TypeTag>
+const NlddColourReport&
+NonlinearSystemBlackOilReservoir<TypeTag>::
+colourAccumulatedReports() const
+{
+    if (!nlddSolver_)
+        OPM_THROW(std::runtime_error, "Cannot get colour reports from a model without NLDD solver");
+    return nlddSolver_->colourAccumulatedReports();
+}
+
 template <class TypeTag>
 void
 NonlinearSystemBlackOilReservoir<TypeTag>::
@@ -24,6 +24,7 @@
 #include <dune/istl/bvector.hh>
 
 #include <opm/simulators/flow/BlackoilModelParameters.hpp>
+#include <opm/simulators/flow/NlddReporting.hpp>
 #include <opm/simulators/flow/NonlinearSystem.hpp>
 
 #include <opm/simulators/timestepping/ConvergenceReport.hpp>
@@ -98,6 +99,12 @@ public:
       return emptyReports;
     }
 
+    const NlddColourReport& colourAccumulatedReports() const
+    {
+      static const NlddColourReport emptyReport{};
+      return emptyReport;
+    }
+
     void writeNonlinearIterationsPerCell(const std::filesystem::path&) const {}
 
     template<class T>
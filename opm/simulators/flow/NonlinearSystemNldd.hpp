@@ -65,9 +65,11 @@
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <exception>
 #include <filesystem>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <set>
 #include <sstream>
 #include <string>
@@ -96,6 +98,7 @@ public:
     using Domain = SubDomain<Grid>;
     using ISTLSolverType = ISTLSolver<TypeTag>;
     using Mat = typename NonlinearSystemBlackOilReservoir<TypeTag>::Mat;
+    using Problem = GetPropType<TypeTag, Properties::Problem>;
 
     static constexpr int numEq = Indices::numEq;
 
@@ -190,6 +193,18 @@ public:
         // Initialize domain_needs_solving_ to true for all domains
         domain_needs_solving_.resize(num_domains, true);
 
+        // Colour the subdomains such that neighbouring subdomains never share
+        // a colour. Subdomains of one colour can be solved concurrently.
+        cell_domain_ = partition_vector;
+        domain_colour_ = this->colourDomains();
+        num_domain_colours_ = domain_colour_.empty()
+            ? 0 : *std::ranges::max_element(domain_colour_) + 1;
+        colour_reports_accumulated_.resize(num_domain_colours_);
+        for (const int colour : domain_colour_) {
+            ++colour_reports_accumulated_.num_domains[colour];
+        }
+        domain_has_wells_.resize(num_domains, 0);
+
         // Set up container for the local system matrices.
         domain_matrices_.resize(num_domains);
 
@@ -280,42 +295,12 @@ public:
         std::vector<SimulatorReportSingle> domain_reports(domains_.size());
 
         OPM_BEGIN_PARALLEL_TRY_CATCH()
-        for (const int domain_index : domain_order) {
-            const auto& domain = domains_[domain_index];
-            SimulatorReportSingle local_report;
-            detailTimer.reset();
-            detailTimer.start();
-
-            domain_needs_solving_[domain_index] = checkIfSubdomainNeedsSolving(domain);
-
-            updateMobilities(domain);
-
-            if (domain.skip || !domain_needs_solving_[domain_index]) {
-                local_report.skipped_domains = true;
-                local_report.converged = true;
-                domain_reports[domain.index] = local_report;
-                continue;
-            }
-            switch (model_.param().local_solve_approach_) {
-            case DomainSolveApproach::Jacobi:
-                solveDomainJacobi(solution, locally_solved, local_report, logger,
-                                  timer, domain);
-                break;
-            default:
-            case DomainSolveApproach::GaussSeidel:
-                solveDomainGaussSeidel(solution, locally_solved, local_report, logger,
-                                       timer, domain);
-                break;
-            }
-            // This should have updated the global matrix to be
-            // dR_i/du_j evaluated at new local solutions for
-            // i == j, at old solution for i != j.
-            if (!local_report.converged) {
-                // TODO: more proper treatment, including in parallel.
-                logger.debug(fmt::format("Convergence failure in domain {} on rank {}." , domain.index, rank_));
-            }
-            local_report.solver_time += detailTimer.stop();
-            domain_reports[domain.index] = local_report;
+        if (this->solveDomainsConcurrently()) {
+            this->solveDomainsConcurrent(domain_order, solution, locally_solved,
+                                         domain_reports, logger, timer);
+        } else {
+            this->solveDomainsSerial(domain_order, solution, locally_solved,
+                                     domain_reports, logger, timer);
         }
         OPM_END_PARALLEL_TRY_CATCH("Unexpected exception in local domain solve: ", model_.simulator().vanguard().grid().comm());
 
@@ -444,6 +429,12 @@ public:
         return domain_reports_accumulated_;
     }
 
+    /// return the solve times of the subdomain colours accumulated for this rank
+    const NlddColourReport& colourAccumulatedReports() const
+    {
+        return colour_reports_accumulated_;
+    }
+
     /// Write the partition vector to a file in ResInsight compatible format for inspection
     /// and a partition file for each rank, that can be used as input for OPM.
     void writePartitions(const std::filesystem::path& odir) const
@@ -477,20 +468,206 @@ public:
     }
 
 private:
+    //! \brief Solve the subdomains one at a time, in the given order.
+    template<class GlobalEqVector>
+    void solveDomainsSerial(const std::vector<int>& domain_order,
+                            GlobalEqVector& solution,
+                            GlobalEqVector& locally_solved,
+                            std::vector<SimulatorReportSingle>& domain_reports,
+                            DeferredLogger& logger,
+                            const SimulatorTimerInterface& timer,
+                            const bool check_needs_solving = true)
+    {
+        Dune::Timer detailTimer;
+        for (const int domain_index : domain_order) {
+            const auto& domain = domains_[domain_index];
+            SimulatorReportSingle local_report;
+            detailTimer.reset();
+            detailTimer.start();
+
+            if (check_needs_solving) {
+                domain_needs_solving_[domain_index] = checkIfSubdomainNeedsSolving(domain);
+                updateMobilities(domain);
+            }
+
+            if (domain.skip || !domain_needs_solving_[domain_index]) {
+                local_report.skipped_domains = true;
+                local_report.converged = true;
+                domain_reports[domain.index] = local_report;
+                continue;
+            }
+            switch (model_.param().local_solve_approach_) {
+            case DomainSolveApproach::Jacobi:
+                solveDomainJacobi(solution, locally_solved, local_report, logger,
+                                  timer, domain);
+                break;
+            default:
+            case DomainSolveApproach::GaussSeidel:
+            case DomainSolveApproach::ColouredGaussSeidel:
+                solveDomainGaussSeidel(solution, locally_solved, local_report, logger,
+                                       timer, domain);
+                break;
+            }
+            // This should have updated the global matrix to be
+            // dR_i/du_j evaluated at new local solutions for
+            // i == j, at old solution for i != j.
+            if (!local_report.converged) {
+                // TODO: more proper treatment, including in parallel.
+                logger.debug(fmt::format("Convergence failure in domain {} on rank {}." , domain.index, rank_));
+            }
+            local_report.solver_time += detailTimer.stop();
+            domain_reports[domain.index] = local_report;
+        }
+    }
+
+    //! \brief Whether the subdomains are solved concurrently by several threads.
+    bool solveDomainsConcurrently() const
+    {
+        // Boundary conditions and separately added sparse source terms are
+        // linearized for the whole grid on every subdomain linearization,
+        // which is not safe to do from several threads.
+        const auto approach = model_.param().local_solve_approach_;
+        const bool concurrent_jacobi = approach == DomainSolveApproach::Jacobi
+            && model_.param().nldd_local_solve_threads_ > 1;
+        return (concurrent_jacobi || approach == DomainSolveApproach::ColouredGaussSeidel)
+            && !model_.simulator().problem().nonTrivialBoundaryConditions()
+            && !Parameters::Get<Parameters::SeparateSparseSourceTerms>();
+    }
+
+    //! \brief Solve the subdomains colour by colour, using several threads.
+    //!
+    //! Subdomains of the same colour are solved concurrently, one colour at
+    //! a time, so that no subdomain is updated while a neighbouring subdomain
+    //! reads its intensive quantities or writes to the same matrix rows. With
+    //! the Jacobi approach every subdomain solve starts from, and restores,
+    //! the initial solution, so the result does not depend on the order. With
+    //! the coloured Gauss-Seidel approach a colour sees the updated solution
+    //! of all previous colours. Subdomains coupled to wells are solved one at
+    //! a time afterwards, as the well model is not thread safe.
+    template<class GlobalEqVector>
+    void solveDomainsConcurrent(const std::vector<int>& domain_order,
+                                GlobalEqVector& solution,
+                                GlobalEqVector& locally_solved,
+                                std::vector<SimulatorReportSingle>& domain_reports,
+                                DeferredLogger& logger,
+                                const SimulatorTimerInterface& timer)
+    {
+        const bool jacobi = model_.param().local_solve_approach_ == DomainSolveApproach::Jacobi;
+        this->updateDomainWellCoupling();
+
+        std::vector<int> well_domains;
+        std::vector<std::vector<int>> colour_domains(num_domain_colours_);
+        for (const int domain_index : domain_order) {
+            const auto& domain = domains_[domain_index];
+            domain_needs_solving_[domain_index] = checkIfSubdomainNeedsSolving(domain);
+            updateMobilities(domain);
+            if (domain.skip || !domain_needs_solving_[domain_index]) {
+                SimulatorReportSingle local_report;
+                local_report.skipped_domains = true;
+                local_report.converged = true;
+                domain_reports[domain.index] = local_report;
+                continue;
+            }
+            if (domain_has_wells_[domain_index]) {
+                well_domains.push_back(domain_index);
+            } else {
+                colour_domains[domain_colour_[domain_index]].push_back(domain_index);
+            }
+        }
+
+        std::vector<DeferredLogger> domain_loggers(domains_.size());
+        {
+            // All concurrent solves share the problem's local solve context,
+            // while each solve counts its local iterations in its own copy.
+            LocalContextGuard localCtxGuard(model_.simulator().problem());
+            const int num_threads = model_.param().nldd_local_solve_threads_;
+            for (int colour = 0; colour < num_domain_colours_; ++colour) {
+                const auto& domain_indices = colour_domains[colour];
+                if (domain_indices.empty()) {
+                    continue;
+                }
+                Dune::Timer colourTimer;
+                colourTimer.start();
+                const int num_domains = domain_indices.size();
+                std::exception_ptr failure;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic, 1)
+#endif
+                for (int i = 0; i < num_domains; ++i) {
+                    const int domain_index = domain_indices[i];
+                    try {
+                        Dune::Timer detailTimer;
+                        detailTimer.start();
+                        SimulatorReportSingle local_report;
+                        NewtonIterationContext localCtx = localCtxGuard.context();
+                        if (jacobi) {
+                            solveDomainJacobi(solution, locally_solved, local_report,
+                                              domain_loggers[domain_index], timer,
+                                              domains_[domain_index], &localCtx);
+                        } else {
+                            solveDomainGaussSeidel(solution, locally_solved, local_report,
+                                                   domain_loggers[domain_index], timer,
+                                                   domains_[domain_index], &localCtx);
+                        }
+                        if (!local_report.converged) {
+                            domain_loggers[domain_index].debug(fmt::format("Convergence failure in domain {} on rank {}.",
+                                                                           domain_index, rank_));
+                        }
+                        local_report.solver_time += detailTimer.stop();
+                        domain_reports[domain_index] = local_report;
+                    }
+                    catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(nldd_concurrent_failure)
+#endif
+                        if (!failure) {
+                            failure = std::current_exception();
+                        }
+                    }
+                }
+                if (failure) {
+                    std::rethrow_exception(failure);
+                }
+                model_.simulator().problem().endIteration();
+                colour_reports_accumulated_.solve_time[colour] += colourTimer.stop();
+                colour_reports_accumulated_.solved_domains[colour] += num_domains;
+            }
+        }
+
+        // Merge the messages in a deterministic order.
+        for (const int domain_index : domain_order) {
+            logger.append(domain_loggers[domain_index]);
+        }
+
+        this->solveDomainsSerial(well_domains, solution, locally_solved,
+                                 domain_reports, logger, timer,
+                                 /*check_needs_solving=*/false);
+    }
+
     //! \brief Solve the equation system for a single domain.
+    //!
+    //! If concurrent_ctx is given, the domain is solved concurrently with
+    //! other, non-neighbouring and well-free, domains. Its local iterations
+    //! are then counted in concurrent_ctx, the well model is not touched, and
+    //! calling the problem's endIteration() is left to the caller.
     ConvergenceReport
     solveDomain(const Domain& domain,
                 const SimulatorTimerInterface& timer,
                 SimulatorReportSingle& local_report,
                 DeferredLogger& logger,
-                const bool initial_assembly_required)
+                const bool initial_assembly_required,
+                NewtonIterationContext* concurrent_ctx = nullptr)
     {
         auto& modelSimulator = model_.simulator();
         Dune::Timer detailTimer;
 
         // RAII guard: local iteration context for this domain, restored on scope exit.
-        LocalContextGuard localCtxGuard(modelSimulator.problem());
-        auto& localCtx = localCtxGuard.context();
+        std::optional<LocalContextGuard<Problem>> localCtxGuard;
+        if (!concurrent_ctx) {
+            localCtxGuard.emplace(modelSimulator.problem());
+        }
+        auto& localCtx = concurrent_ctx ? *concurrent_ctx : localCtxGuard->context();
+        const bool with_wells = concurrent_ctx == nullptr;
 
         // When called, if assembly has already been performed
         // with the initial values, we only need to check
@@ -500,8 +677,10 @@ private:
             detailTimer.start();
             // TODO: we should have a beginIterationLocal function()
             // only handling the well model for now
-            wellModel_.assemble(modelSimulator.timeStepSize(),
-                                domain);
+            if (with_wells) {
+                wellModel_.assemble(modelSimulator.timeStepSize(),
+                                    domain);
+            }
             const double tt0 = detailTimer.stop();
             local_report.assemble_time += tt0;
             local_report.assemble_time_well += tt0;
@@ -515,7 +694,8 @@ private:
         detailTimer.reset();
         detailTimer.start();
         std::vector<Scalar> resnorms;
-        auto convreport = this->getDomainConvergence(domain, timer, logger, resnorms);
+        auto convreport = this->getDomainConvergence(domain, timer, logger, resnorms,
+                                                     localCtx, with_wells);
         local_report.update_time += detailTimer.stop();
         if (convreport.converged()) {
             // TODO: set more info, timing etc.
@@ -527,9 +707,11 @@ private:
         // but not done the Schur complement for the wells yet.
         detailTimer.reset();
         detailTimer.start();
-        model_.wellModel().linearizeDomain(domain,
-                                           modelSimulator.model().linearizer().jacobian(),
-                                           modelSimulator.model().linearizer().residual());
+        if (with_wells) {
+            model_.wellModel().linearizeDomain(domain,
+                                               modelSimulator.model().linearizer().jacobian(),
+                                               modelSimulator.model().linearizer().residual());
+        }
         const double tt1 = detailTimer.stop();
         local_report.assemble_time += tt1;
         local_report.assemble_time_well += tt1;
@@ -561,13 +743,17 @@ private:
                 local_report.linear_solve_time += detailTimer.stop();
                 local_report.linear_solve_setup_time += setup_time;
                 local_report.total_linear_iterations = domain_linsolvers_[domain.index].iterations();
-                modelSimulator.problem().endIteration();
+                if (with_wells) {
+                    modelSimulator.problem().endIteration();
+                }
                 local_report.converged = false;
                 local_report.total_newton_iterations = localCtx.iteration();
                 local_report.total_linearizations += localCtx.iteration();
                 return convreport;
             }
-            model_.wellModel().postSolveDomain(x, domain);
+            if (with_wells) {
+                model_.wellModel().postSolveDomain(x, domain);
+            }
             if (damping_factor != 1.0) {
                 x *= damping_factor;
             }
@@ -588,8 +774,10 @@ private:
             // TODO: we should have a beginIterationLocal function()
             // only handling the well model for now
             // Assemble reservoir locally.
-            wellModel_.assemble(modelSimulator.timeStepSize(),
-                                domain);
+            if (with_wells) {
+                wellModel_.assemble(modelSimulator.timeStepSize(),
+                                    domain);
+            }
             const double tt3 = detailTimer.stop();
             local_report.assemble_time += tt3;
             local_report.assemble_time_well += tt3;
@@ -602,7 +790,8 @@ private:
             detailTimer.reset();
             detailTimer.start();
             resnorms.clear();
-            convreport = this->getDomainConvergence(domain, timer, logger, resnorms);
+            convreport = this->getDomainConvergence(domain, timer, logger, resnorms,
+                                                    localCtx, with_wells);
             convergence_history.push_back(resnorms);
             local_report.update_time += detailTimer.stop();
 
@@ -610,9 +799,11 @@ private:
             // reservoir linearized equations
             detailTimer.reset();
             detailTimer.start();
-            model_.wellModel().linearizeDomain(domain,
-                                               modelSimulator.model().linearizer().jacobian(),
-                                               modelSimulator.model().linearizer().residual());
+            if (with_wells) {
+                model_.wellModel().linearizeDomain(domain,
+                                                   modelSimulator.model().linearizer().jacobian(),
+                                                   modelSimulator.model().linearizer().residual());
+            }
             const double tt2 = detailTimer.stop();
             local_report.assemble_time += tt2;
             local_report.assemble_time_well += tt2;
@@ -631,7 +822,9 @@ private:
             }
         } while (!convreport.converged() && localCtx.iteration() <= max_iter);
 
-        modelSimulator.problem().endIteration();
+        if (with_wells) {
+            modelSimulator.problem().endIteration();
+        }
 
         local_report.converged = convreport.converged();
         local_report.total_newton_iterations = localCtx.iteration();
@@ -765,12 +958,12 @@ private:
                                                     const Domain& domain,
                                                     DeferredLogger& logger,
                                                     std::vector<Scalar>& B_avg,
-                                                    std::vector<Scalar>& residual_norms)
+                                                    std::vector<Scalar>& residual_norms,
+                                                    const NewtonIterationContext& iterCtx)
     {
         using Vector = std::vector<Scalar>;
 
-        const auto& iterCtx = model_.simulator().problem().iterationContext();
-        
+
         const int numComp = numEq;
         Vector R_sum(numComp, 0.0 );
         Vector maxCoeff(numComp, std::numeric_limits<Scalar>::lowest() );
@@ -903,7 +1096,9 @@ private:
     ConvergenceReport getDomainConvergence(const Domain& domain,
                                            const SimulatorTimerInterface& timer,
                                            DeferredLogger& logger,
-                                           std::vector<Scalar>& residual_norms)
+                                           std::vector<Scalar>& residual_norms,
+                                           const NewtonIterationContext& iterCtx,
+                                           const bool with_wells)
     {
         OPM_TIMEBLOCK(getDomainConvergence);
         std::vector<Scalar> B_avg(numEq, 0.0);
@@ -912,8 +1107,11 @@ private:
                                                           domain,
                                                           logger,
                                                           B_avg,
-                                                          residual_norms);
-        report += wellModel_.getWellConvergence(domain, B_avg, logger);
+                                                          residual_norms,
+                                                          iterCtx);
+        if (with_wells) {
+            report += wellModel_.getWellConvergence(domain, B_avg, logger);
+        }
         return report;
     }
 
@@ -926,10 +1124,12 @@ private:
         std::vector<int> domain_order(domains_.size());
         std::iota(domain_order.begin(), domain_order.end(), 0);
 
-        if (model_.param().local_solve_approach_ == DomainSolveApproach::Jacobi) {
+        const auto approach = model_.param().local_solve_approach_;
+        if (approach == DomainSolveApproach::Jacobi) {
             // Do nothing, 0..n-1 order is fine.
             return domain_order;
-        } else if (model_.param().local_solve_approach_ == DomainSolveApproach::GaussSeidel) {
+        } else if (approach == DomainSolveApproach::GaussSeidel ||
+                   approach == DomainSolveApproach::ColouredGaussSeidel) {
             // Calculate the measure used to order the domains.
             std::vector<Scalar> measure_per_domain(domains_.size());
             switch (model_.param().local_domains_ordering_) {
@@ -976,9 +1176,15 @@ private:
             const auto& m = measure_per_domain;
             std::stable_sort(domain_order.begin(), domain_order.end(),
                              [&m](const int i1, const int i2){ return m[i1] > m[i2]; });
+            if (approach == DomainSolveApproach::ColouredGaussSeidel) {
+                // Solve colour by colour, by measure within each colour.
+                const auto& c = domain_colour_;
+                std::stable_sort(domain_order.begin(), domain_order.end(),
+                                 [&c](const int i1, const int i2){ return c[i1] < c[i2]; });
+            }
             return domain_order;
         } else {
-            throw std::logic_error("Domain solve approach must be Jacobi or Gauss-Seidel");
+            throw std::logic_error("Domain solve approach must be Jacobi, Gauss-Seidel or coloured Gauss-Seidel");
         }
     }
 
@@ -988,11 +1194,12 @@ private:
                            SimulatorReportSingle& local_report,
                            DeferredLogger& logger,
                            const SimulatorTimerInterface& timer,
-                           const Domain& domain)
+                           const Domain& domain,
+                           NewtonIterationContext* concurrent_ctx = nullptr)
     {
         auto initial_local_well_primary_vars = wellModel_.getPrimaryVarsDomain(domain.index);
         auto initial_local_solution = Details::extractVector(solution, domain.cells);
-        auto convrep = solveDomain(domain, timer, local_report, logger, false);
+        auto convrep = solveDomain(domain, timer, local_report, logger, false, concurrent_ctx);
         if (local_report.converged) {
             auto local_solution = Details::extractVector(solution, domain.cells);
             Details::setGlobal(local_solution, domain.cells, locally_solved);
@@ -1011,11 +1218,12 @@ private:
                                 SimulatorReportSingle& local_report,
                                 DeferredLogger& logger,
                                 const SimulatorTimerInterface& timer,
-                                const Domain& domain)
+                                const Domain& domain,
+                                NewtonIterationContext* concurrent_ctx = nullptr)
     {
         auto initial_local_well_primary_vars = wellModel_.getPrimaryVarsDomain(domain.index);
         auto initial_local_solution = Details::extractVector(solution, domain.cells);
-        auto convrep = solveDomain(domain, timer, local_report, logger, true);
+        auto convrep = solveDomain(domain, timer, local_report, logger, true, concurrent_ctx);
         if (!local_report.converged) {
             // We look at the detailed convergence report to evaluate
             // if we should accept the unconverged solution.
@@ -1141,6 +1349,63 @@ private:
                                      param.local_domains_partition_well_neighbor_levels_);
     }
 
+    //! \brief Greedy colouring of the subdomain graph, in which two
+    //! subdomains are neighbours if they share a face.
+    //! \return The colour of each subdomain.
+    std::vector<int> colourDomains() const
+    {
+        const auto& gridView = model_.simulator().vanguard().grid().leafGridView();
+        const auto& elementMapper = model_.simulator().model().elementMapper();
+        const int num_interior = cell_domain_.size();
+
+        std::vector<std::set<int>> neighbours(domains_.size());
+        for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
+            const int domain = cell_domain_[elementMapper.index(elem)];
+            for (const auto& intersection : intersections(gridView, elem)) {
+                if (!intersection.neighbor()) {
+                    continue;
+                }
+                const int nb = elementMapper.index(intersection.outside());
+                if (nb < num_interior && cell_domain_[nb] != domain) {
+                    neighbours[domain].insert(cell_domain_[nb]);
+                }
+            }
+        }
+
+        std::vector<int> colour(domains_.size(), -1);
+        for (std::size_t domain = 0; domain < domains_.size(); ++domain) {
+            std::set<int> used;
+            for (const int nb : neighbours[domain]) {
+                if (colour[nb] >= 0) {
+                    used.insert(colour[nb]);
+                }
+            }
+            int c = 0;
+            while (used.count(c) > 0) {
+                ++c;
+            }
+            colour[domain] = c;
+        }
+        return colour;
+    }
+
+    //! \brief Flag the subdomains that have wells assigned to them, or
+    //! contain perforated cells of any well.
+    void updateDomainWellCoupling()
+    {
+        std::ranges::fill(domain_has_wells_, 0);
+        for (const auto& [wname, domain] : wellModel_.well_domain()) {
+            domain_has_wells_[domain] = 1;
+        }
+        for (const auto& well : model_.wellModel().localNonshutWells()) {
+            for (const int cell : well->cells()) {
+                if (cell < static_cast<int>(cell_domain_.size())) {
+                    domain_has_wells_[cell_domain_[cell]] = 1;
+                }
+            }
+        }
+    }
+
     void updateMobilities(const Domain& domain)
     {
         if (domain.skip || model_.param().nldd_relative_mobility_change_tol_ == 0.0) {
@@ -1220,11 +1485,19 @@ private:
     SimulatorReport local_reports_accumulated_; //!< Accumulated convergence report for subdomain solvers per rank
     // mutable because we need to update the number of wells for each domain in getDomainAccumulatedReports()
     mutable std::vector<SimulatorReport> domain_reports_accumulated_; //!< Accumulated convergence reports per domain
+    NlddColourReport colour_reports_accumulated_; //!< Accumulated solve times per subdomain colour
     int rank_ = 0; //!< MPI rank of this process
     // Store previous mobilities to check for changes - single flat vector indexed by (globalCellIdx * numActivePhases + activePhaseIdx)
     std::vector<Scalar> previousMobilities_;
     // Flag indicating if this domain should be solved in the next iteration
     std::vector<bool> domain_needs_solving_;
+    // Subdomain of each interior cell
+    std::vector<int> cell_domain_;
+    // Colour of each subdomain, neighbouring subdomains have different colours
+    std::vector<int> domain_colour_;
+    int num_domain_colours_ = 0;
+    // Flag indicating if a subdomain is coupled to any well, updated before concurrent solves
+    std::vector<char> domain_has_wells_;
 };
 
 } // namespace Opm
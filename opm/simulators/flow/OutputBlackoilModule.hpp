@@ -66,6 +66,7 @@
 #include <functional>
 #include <limits>
 #include <map>
+#include <optional>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -334,6 +335,27 @@ public:
             return;
         }
 
+        for (unsigned dofIdx = 0; dofIdx < elemCtx.numPrimaryDof(/*timeIdx=*/0); ++dofIdx) {
+            this->processCell(elemCtx.globalSpaceIndex(dofIdx, /*timeIdx=*/0),
+                              elemCtx.intensiveQuantities(dofIdx, /*timeIdx=*/0));
+        }
+    }
+
+    /*!
+     * \brief Modify the internal buffers according to the intensive
+     *        quantities of a single cell.
+     *
+     * Only the entries of the given cell are written, and the region
+     * averaged densities are collected in per-thread accumulators, so
+     * this may be called concurrently for distinct cells.
+     */
+    void processCell(const unsigned globalDofIdx,
+                     const IntensiveQuantities& intQuants)
+    {
+        if (!std::is_same<Discretization, EcfvDiscretization<TypeTag>>::value) {
+            return;
+        }
+
         if (this->extractors_.empty()) {
             assert(0);
         }
@@ -341,36 +363,39 @@ public:
         const auto& matLawManager = simulator_.problem().materialLawManager();
 
         typename Extractor::HysteresisParams hysterParams;
-        for (unsigned dofIdx = 0; dofIdx < elemCtx.numPrimaryDof(/*timeIdx=*/0); ++dofIdx) {
-            const auto& intQuants = elemCtx.intensiveQuantities(dofIdx, /*timeIdx=*/0);
-            const auto& fs = intQuants.fluidState();
-
-            const typename Extractor::Context ectx{
-                elemCtx.globalSpaceIndex(dofIdx, /*timeIdx=*/0),
-                elemCtx.primaryVars(dofIdx, /*timeIdx=*/0).pvtRegionIndex(),
-                elemCtx.simulator().episodeIndex(),
-                fs,
-                intQuants,
-                hysterParams
-            };
+        const typename Extractor::Context ectx{
+            globalDofIdx,
+            intQuants.pvtRegionIndex(),
+            simulator_.episodeIndex(),
+            intQuants.fluidState(),
+            intQuants,
+            hysterParams
+        };
 
-            if (matLawManager->enableHysteresis()) {
-                if (FluidSystem::phaseIsActive(oilPhaseIdx) && FluidSystem::phaseIsActive(waterPhaseIdx)) {
-                    matLawManager->oilWaterHysteresisParams(hysterParams.somax,
-                                                            hysterParams.swmax,
-                                                            hysterParams.swmin,
-                                                            ectx.globalDofIdx);
-                }
-                if (FluidSystem::phaseIsActive(oilPhaseIdx) && FluidSystem::phaseIsActive(gasPhaseIdx)) {
-                    matLawManager->gasOilHysteresisParams(hysterParams.sgmax,
-                                                          hysterParams.shmax,
-                                                          hysterParams.somin,
-                                                          ectx.globalDofIdx);
-                }
+        if (matLawManager->enableHysteresis()) {
+            if (FluidSystem::phaseIsActive(oilPhaseIdx) && FluidSystem::phaseIsActive(waterPhaseIdx)) {
+                matLawManager->oilWaterHysteresisParams(hysterParams.somax,
+                                                        hysterParams.swmax,
+                                                        hysterParams.swmin,
+                                                        ectx.globalDofIdx);
+            }
+            if (FluidSystem::phaseIsActive(oilPhaseIdx) && FluidSystem::phaseIsActive(gasPhaseIdx)) {
+                matLawManager->gasOilHysteresisParams(hysterParams.sgmax,
+                                                      hysterParams.shmax,
+                                                      hysterParams.somin,
+                                                      ectx.globalDofIdx);
             }
-
-            Extractor::process(ectx, extractors_);
         }
+
+        Extractor::process(ectx, extractors_);
+    }
+
+    //! \brief Whether any block (summary or extra) data is requested.
+    bool hasBlockData() const
+    {
+        return !this->blockExtractors_.empty() ||
+               !this->extraBlockExtractors_.empty() ||
+               !this->lgrBlockExtractors_.empty();
     }
 
     void processElementBlockData(const ElementContext& elemCtx)
@@ -380,10 +405,7 @@ public:
             return;
         }
 
-        if (this->blockExtractors_.empty() &&
-            this->extraBlockExtractors_.empty() &&
-            this->lgrBlockExtractors_.empty())
-        {
+        if (!this->hasBlockData()) {
             return;
         }
 
@@ -550,7 +572,13 @@ public:
     }
 
     /*!
-     * \brief Capture connection fluxes, particularly to account for inter-region flows.
+     * \brief Register the connections of a single element for subsequent
+     *    capture of connection fluxes, particularly to account for
+     *    inter-region flows.
+     *
+     * Requires only the element's stencil.  Registration is done once for
+     * the grid and is kept across calls to initializeFluxData().  Not
+     * thread-safe.
      *
      * \tparam ActiveIndex Callable type, typically a lambda, that enables
      *    retrieving the active index, on the local MPI rank, of a
@@ -576,13 +604,17 @@ public:
      *
      * \param[in] cartesianIndex Mapping from active index on local MPI rank
      *    to globally unique Cartesian cell/element index.
+     *
+     * \return Index of the element's first connection if flow across any
+     *    of its connections contributes to the inter-region flows, and
+     *    nullopt otherwise.
      */
     template <class ActiveIndex, class CartesianIndex>
-    void processFluxes(const ElementContext& elemCtx,
-                       ActiveIndex&&         activeIndex,
-                       CartesianIndex&&      cartesianIndex)
+    std::optional<std::size_t>
+    registerFluxConnections(const ElementContext& elemCtx,
+                            ActiveIndex&&         activeIndex,
+                            CartesianIndex&&      cartesianIndex)
     {
-        OPM_TIMEBLOCK_LOCAL(processFluxes, Subsystem::Output);
         const auto identifyCell = [&activeIndex, &cartesianIndex](const Element& elem)
             -> InterRegFlowMap::Cell
         {
@@ -599,15 +631,59 @@ public:
         const auto& stencil = elemCtx.stencil(timeIdx);
         const auto numInteriorFaces = elemCtx.numInteriorFaces(timeIdx);
 
+        const auto firstConnection = this->numFluxConnections_;
+        auto isInterRegion = false;
+
         for (auto scvfIdx = 0 * numInteriorFaces; scvfIdx < numInteriorFaces; ++scvfIdx) {
             const auto& face = stencil.interiorFace(scvfIdx);
             const auto left  = identifyCell(stencil.element(face.interiorIndex()));
             const auto right = identifyCell(stencil.element(face.exteriorIndex()));
 
+            const auto contributes = this->interRegionFlows_.registerConnection(left, right);
+            isInterRegion = isInterRegion || contributes;
+        }
+
+        this->numFluxConnections_ += numInteriorFaces;
+
+        if (! isInterRegion) {
+            return std::nullopt;
+        }
+
+        return firstConnection;
+    }
+
+    /*!
+     * \brief Capture connection fluxes, particularly to account for inter-region flows.
+     *
+     * Thread-safe.  The element's connections must have been registered
+     * through registerFluxConnections().
+     *
+     * \param[in] elemCtx Primary lookup structure for per-cell/element
+     *    dynamic information.  Extensive quantities must be up to date.
+     *
+     * \param[in] firstConnection Index of the element's first connection,
+     *    as returned from registerFluxConnections().
+     */
+    void processFluxes(const ElementContext& elemCtx,
+                       const std::size_t     firstConnection)
+    {
+        OPM_TIMEBLOCK_LOCAL(processFluxes, Subsystem::Output);
+
+        const auto timeIdx = 0u;
+        const auto& stencil = elemCtx.stencil(timeIdx);
+        const auto numInteriorFaces = elemCtx.numInteriorFaces(timeIdx);
+
+        for (auto scvfIdx = 0 * numInteriorFaces; scvfIdx < numInteriorFaces; ++scvfIdx) {
+            const auto connection = firstConnection + scvfIdx;
+            if (! this->interRegionFlows_.isInterRegionConnection(connection)) {
+                continue;
+            }
+
+            const auto& face = stencil.interiorFace(scvfIdx);
             const auto rates = this->
                 getComponentSurfaceRates(elemCtx, face.area(), scvfIdx, timeIdx);
 
-            this->interRegionFlows_.addConnection(left, right, rates);
+            this->interRegionFlows_.addConnection(connection, rates);
         }
     }
 
@@ -618,7 +694,8 @@ public:
     void initializeFluxData()
     {
         // Inter-region flow rates.  Note: ".clear()" prepares to accumulate
-        // contributions per bulk connection between FIP regions.
+        // contributions per bulk connection between FIP regions.  Registered
+        // connections are kept.
         this->interRegionFlows_.clear();
     }
 
@@ -1444,6 +1521,9 @@ private:
                                            );
                                 } catch (const NumericalProblem&) {
                                     const auto cartesianIdx = vanguard.cartesianIndex(ectx.globalDofIdx);
+#ifdef _OPENMP
+#pragma omp critical(output_failed_cells)
+#endif
                                     failedCells.push_back(cartesianIdx);
                                     return Scalar{0};
                                 }
@@ -1461,6 +1541,9 @@ private:
                                       );
                                   } catch (const NumericalProblem&) {
                                       const auto cartesianIdx =  vanguard.cartesianIndex(ectx.globalDofIdx);
+#ifdef _OPENMP
+#pragma omp critical(output_failed_cells)
+#endif
                                       failedCells.push_back(cartesianIdx);
                                       return Scalar{0};
                                   }
@@ -3325,6 +3408,9 @@ private:
     // the per-DOF lookup in processElementBlockData short-circuits O(1)
     // on levels with no LB* requests.  Empty for non-LGR runs.
     typename BlockExtractor::LgrExecMap lgrBlockExtractors_;
+
+    // Number of connections registered through registerFluxConnections().
+    std::size_t numFluxConnections_{0};
 };
 
 } // namespace Opm
@@ -55,6 +55,7 @@
 #include <cstddef>
 #include <fstream>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -472,37 +473,27 @@ public:
     }
 
     /*!
-     * \brief Capture connection fluxes, particularly to account for inter-region flows.
-     *
-     * \tparam ActiveIndex Callable type, typically a lambda, that enables
-     *    retrieving the active index, on the local MPI rank, of a
-     *    particular cell/element.  Must support a function call operator of
-     *    the form
-     \code
-        int operator()(const Element& elem) const
-     \endcode
-     *
-     * \tparam CartesianIndex Callable type, typically a lambda, that
-     *    enables retrieving the globally unique Cartesian index of a
-     *    particular cell/element given its active index on the local MPI
-     *    rank.  Must support a function call operator of the form
-     \code
-        int operator()(const int activeIndex) const
-     \endcode
+     * \brief Register the connections of a single element for subsequent
+     *    capture of connection fluxes, particularly to account for
+     *    inter-region flows.
      *
-     * \param[in] elemCtx Primary lookup structure for per-cell/element
-     *    dynamic information.
-     *
-     * \param[in] activeIndex Mapping from cell/elements to linear indices
-     *    on local MPI rank.
-     *
-     * \param[in] cartesianIndex Mapping from active index on local MPI rank
-     *    to globally unique Cartesian cell/element index.
+     * Connection fluxes are not captured for compositional models, so no
+     * connections are registered.
      */
     template <class ActiveIndex, class CartesianIndex>
+    std::optional<std::size_t>
+    registerFluxConnections(const ElementContext& /* elemCtx */,
+                            ActiveIndex&&         /* activeIndex */,
+                            CartesianIndex&&      /* cartesianIndex */)
+    {
+        return std::nullopt;
+    }
+
+    /*!
+     * \brief Capture connection fluxes, particularly to account for inter-region flows.
+     */
     void processFluxes(const ElementContext& /* elemCtx */,
-                       ActiveIndex&&         /* activeIndex*/,
-                       CartesianIndex&&      /* cartesianIndex */)
+                       const std::size_t     /* firstConnection */)
     {
     }
 
@@ -32,7 +32,29 @@
 #include <functional>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace {
+    int numThreads()
+    {
+#ifdef _OPENMP
+        return omp_get_max_threads();
+#else
+        return 1;
+#endif
+    }
+
+    int threadNum()
+    {
+#ifdef _OPENMP
+        return omp_get_thread_num();
+#else
+        return 0;
+#endif
+    }
+
     std::vector<std::string> fipRegionNames(const std::vector<std::string>& regionNames)
     {
         auto regs = regionNames;
@@ -85,6 +107,7 @@ RegionPhasePoreVolAverage(const Parallel::Communication&  comm,
     , getRegionArray_ { std::move(getRegionArray) }
     , rsStart_        { regionStartPointers(rsetNames_, getRegionArray_, comm_) }
     , x_              (rsStart_.back() * numPhases * AvgType::NumTypes * Element::NumElem)
+    , threadX_        (numThreads(), x_)
 {}
 
 double Opm::RegionPhasePoreVolAverage::fieldValue(const Phase& p) const
@@ -111,6 +134,11 @@ value(std::string_view rset, const Phase& p, const Region& r) const
 void Opm::RegionPhasePoreVolAverage::prepareAccumulation()
 {
     std::ranges::fill(this->x_, 0.0);
+
+    this->threadX_.resize(numThreads());
+    for (auto& x : this->threadX_) {
+        x.assign(this->x_.size(), 0.0);
+    }
 }
 
 void Opm::RegionPhasePoreVolAverage::
@@ -118,15 +146,22 @@ addCell(const std::size_t activeCell,
         const Phase&      p,
         const CellValue&  cv)
 {
-    this->add(this->fieldStartIx(p.ix), cv);
+    auto& x = this->threadX_[threadNum()];
+
+    this->add(x, this->fieldStartIx(p.ix), cv);
 
     for (auto rset = 0*this->rsetNames_.size(); rset < this->rsetNames_.size(); ++rset) {
-        this->add(this->rsetStartIx(rset, this->regionIndex(rset, activeCell), p.ix), cv);
+        this->add(x, this->rsetStartIx(rset, this->regionIndex(rset, activeCell), p.ix), cv);
     }
 }
 
 void Opm::RegionPhasePoreVolAverage::accumulateParallel()
 {
+    for (auto& x : this->threadX_) {
+        std::ranges::transform(this->x_, x, this->x_.begin(), std::plus<>{});
+        std::ranges::fill(x, 0.0);
+    }
+
     this->comm_.get().sum(this->x_.data(), static_cast<int>(this->x_.size()));
 }
 
@@ -172,29 +207,22 @@ int Opm::RegionPhasePoreVolAverage::regionIndex(const std::size_t rset,
     return this->getRegionArray_(this->rsetNames_[rset])[activeCell];
 }
 
-void Opm::RegionPhasePoreVolAverage::add(const Ix start, const CellValue& cv)
-{
-    this->add(start, AvgType::SatPV, cv.value, cv.sat * cv.porv);
-    this->add(start, AvgType::PV   , cv.value,          cv.porv);
-}
-
-void Opm::RegionPhasePoreVolAverage::add(const Ix      start,
-                                         const AvgType type,
-                                         const double  x,
-                                         const double  w)
+void Opm::RegionPhasePoreVolAverage::add(std::vector<double>& sums,
+                                         const Ix             start,
+                                         const CellValue&     cv)
 {
-    this->value (start, type) += w * x;
-    this->weight(start, type) += w;
+    this->add(sums, start, AvgType::SatPV, cv.value, cv.sat * cv.porv);
+    this->add(sums, start, AvgType::PV   , cv.value,          cv.porv);
 }
 
-double& Opm::RegionPhasePoreVolAverage::value(const Ix start, const AvgType type)
+void Opm::RegionPhasePoreVolAverage::add(std::vector<double>& sums,
+                                         const Ix             start,
+                                         const AvgType        type,
+                                         const double         x,
+                                         const double         w)
 {
-    return this->x_[ this->valueArrayIndex(start, type, Element::Value) ];
-}
-
-double& Opm::RegionPhasePoreVolAverage::weight(const Ix start, const AvgType type)
-{
-    return this->x_[ this->valueArrayIndex(start, type, Element::Weight) ];
+    sums[ this->valueArrayIndex(start, type, Element::Value)  ] += w * x;
+    sums[ this->valueArrayIndex(start, type, Element::Weight) ] += w;
 }
 
 double Opm::RegionPhasePoreVolAverage::value(const Ix start, const AvgType type) const
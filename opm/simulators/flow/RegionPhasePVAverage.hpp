@@ -117,6 +117,8 @@ namespace Opm {
 
         /// Incorporate contributions from a single cell.
         ///
+        /// Thread safe with respect to other calls to addCell().
+        ///
         /// \param[in] activeCell Per-rank active cell ID--typically one of
         ///   the rank's interior cells.
         ///
@@ -189,6 +191,13 @@ namespace Opm {
         /// should be the return value from fieldStartIx() or rsetStartIx().
         std::vector<double> x_{};
 
+        /// Per-thread running sums, laid out like \c x_.  Contributions
+        /// from addCell() go to the array of the calling thread, which
+        /// allows concurrent calls from within an OpenMP parallel region.
+        /// The per-thread sums are folded into \c x_ in
+        /// accumulateParallel().
+        std::vector<std::vector<double>> threadX_{};
+
         /// Compute final average value for a single region and phase.
         ///
         /// Prefers the average value weighted by phase-filled pore-volume,
@@ -258,16 +267,22 @@ namespace Opm {
 
         /// Incorporate per-cell contribution into all average function types.
         ///
+        /// \param[in,out] sums Linearised array of running sums.  Either
+        ///   \c x_ or one of the per-thread arrays in \c threadX_.
+        ///
         /// \param[in] start Offset into linearised value array (\c x_)
         ///   corresponding to the first average value type of a particular
         ///   phase in a particular region.  Usually calculated by
         ///   fieldStartIx() or rsetStartIx().
         ///
         /// \param[in] cv Single cell function value contribution.
-        void add(Ix start, const CellValue& cv);
+        void add(std::vector<double>& sums, Ix start, const CellValue& cv);
 
         /// Incorporate per-cell contribution into specific function type.
         ///
+        /// \param[in,out] sums Linearised array of running sums.  Either
+        ///   \c x_ or one of the per-thread arrays in \c threadX_.
+        ///
         /// \param[in] start Offset into linearised value array (\c x_)
         ///   corresponding to the first average value type of a particular
         ///   phase in a particular region.  Usually calculated by
@@ -278,33 +293,7 @@ namespace Opm {
         /// \param[in] x Function value.
         ///
         /// \param[in] w Function weight.
-        void add(Ix start, AvgType type, double x, double w);
-
-        /// Mutable access to value item of specific average value type
-        ///
-        /// \param[in] start Offset into linearised value array (\c x_)
-        ///   corresponding to the first average value type of a particular
-        ///   phase in a particular region.  Usually calculated by
-        ///   fieldStartIx() or rsetStartIx().
-        ///
-        /// \param[in] type Which kind of average value to accumulate.
-        ///
-        /// \return Reference to mutable element of linearised value array
-        ///   corresponding to the running sum of function values.
-        double& value(Ix start, AvgType type);
-
-        /// Mutable access to weight item of specific average value type
-        ///
-        /// \param[in] start Offset into linearised value array (\c x_)
-        ///   corresponding to the first average value type of a particular
-        ///   phase in a particular region.  Usually calculated by
-        ///   fieldStartIx() or rsetStartIx().
-        ///
-        /// \param[in] type Which kind of average value to accumulate.
-        ///
-        /// \return Reference to mutable element of linearised value array
-        ///   corresponding to the running sum of function weights.
-        double& weight(Ix start, AvgType type);
+        void add(std::vector<double>& sums, Ix start, AvgType type, double x, double w);
 
         /// Read-only access to value item of specific average value type
         ///
@@ -62,6 +62,17 @@ void registerSimulatorParameters()
         ("FileName for .OPMRST file used to load serialized state. "
          "If empty, CASENAME.OPMRST is used.");
     Parameters::Hide<Parameters::LoadFile>();
+    Parameters::Register<Parameters::SaveCollective>
+        ("Store the serialized state of all processes in shared datasets "
+         "of the .OPMRST file, written with collective parallel I/O. "
+         "If false, one dataset is written for each process.");
+    Parameters::Register<Parameters::SaveCompressed>
+        ("Compress the serialized state saved to the .OPMRST file.");
+    Parameters::Register<Parameters::SaveDeltaInterval>
+        ("Save every n'th serialized state in full, and the states "
+         "in between as the changes relative to the last full state. "
+         "Values below 2 save all states in full. Not used when only "
+         "the last step is kept.");
     Parameters::Register<Parameters::Slave>
         ("Specify if the simulation is a slave simulation in a master-slave simulation");
     Parameters::Hide<Parameters::Slave>();
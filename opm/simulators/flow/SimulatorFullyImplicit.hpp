@@ -67,6 +67,9 @@ struct SaveStep { static constexpr auto* value = ""; };
 struct SaveFile { static constexpr auto* value = ""; };
 struct LoadFile { static constexpr auto* value = ""; };
 struct LoadStep { static constexpr int value = -1; };
+struct SaveCollective { static constexpr bool value = false; };
+struct SaveCompressed { static constexpr bool value = true; };
+struct SaveDeltaInterval { static constexpr int value = 0; };
 struct Slave { static constexpr bool value = false; };
 
 } // namespace Opm::Parameters
@@ -52,7 +52,10 @@ SimulatorFullyImplicit(Simulator& simulator)
                   Parameters::Get<Parameters::SaveStep>(),
                   Parameters::Get<Parameters::LoadStep>(),
                   Parameters::Get<Parameters::SaveFile>(),
-                  Parameters::Get<Parameters::LoadFile>())
+                  Parameters::Get<Parameters::LoadFile>(),
+                  Parameters::Get<Parameters::SaveCollective>(),
+                  Parameters::Get<Parameters::SaveCompressed>(),
+                  Parameters::Get<Parameters::SaveDeltaInterval>())
 {
     // Only rank 0 does print to std::cout, and only if specifically requested.
     this->terminalOutput_ = false;
@@ -603,7 +606,7 @@ saveState([[maybe_unused]] HDF5Serializer& serializer,
           [[maybe_unused]] const std::string& groupName) const
 {
 #if HAVE_HDF5
-    serializer.write(*this, groupName, "simulator_data");
+    serializer.write(*this, groupName, "simulator_data", serializer.processMode());
 #endif
 }
 
@@ -47,7 +47,10 @@ SimulatorSerializer::SimulatorSerializer([[maybe_unused]] SerializableSim& simul
                                          const std::string& saveSpec,
                                          int loadStep,
                                          const std::string& saveFile,
-                                         const std::string& loadFile)
+                                         const std::string& loadFile,
+                                         bool saveCollective,
+                                         bool saveCompressed,
+                                         int saveDeltaInterval)
 #if HAVE_HDF5
     : simulator_(simulator)
     , comm_(comm)
@@ -57,6 +60,9 @@ SimulatorSerializer::SimulatorSerializer([[maybe_unused]] SerializableSim& simul
     , loadStep_(loadStep)
     , saveFile_(saveFile)
     , loadFile_(loadFile)
+    , saveCollective_(saveCollective)
+    , saveCompressed_(saveCompressed)
+    , saveDeltaInterval_(saveDeltaInterval)
 {
     if (saveSpec == "all") {
         saveStride_ = 1;
@@ -93,6 +99,8 @@ SimulatorSerializer::SimulatorSerializer([[maybe_unused]] SerializableSim& simul
     }
 }
 
+SimulatorSerializer::~SimulatorSerializer() = default;
+
 void SimulatorSerializer::save(SimulatorTimer& timer)
 {
     if (saveStride_ == 0 && saveStep_ == -1) {
@@ -108,8 +116,12 @@ void SimulatorSerializer::save(SimulatorTimer& timer)
         const std::string groupName = "/report_step/" + std::to_string(nextStep);
         if (saveStride_ < 0 || nextStep == saveStride_ || nextStep == saveStep_) {
             std::filesystem::remove(saveFile_);
+            saveCount_ = 0;
         }
-        HDF5Serializer writer(saveFile_, HDF5File::OpenMode::APPEND, comm_);
+        HDF5Serializer writer(saveFile_, HDF5File::OpenMode::APPEND, comm_,
+                              saveCollective_ ? HDF5File::DataSetMode::COLLECTIVE
+                                              : HDF5File::DataSetMode::PROCESS_SPLIT,
+                              saveCompressed_);
         if (saveStride_ < 0 || nextStep == saveStride_ || nextStep == saveStep_) {
             const auto data = simulator_.getHeader();
             writer.writeHeader(data[0], data[1], data[2], data[3], data[4], comm_.size());
@@ -117,10 +129,19 @@ void SimulatorSerializer::save(SimulatorTimer& timer)
             if (comm_.size() > 1) {
                 const auto& cellMapping = simulator_.getCellMapping();
                 std::size_t hash = Dune::hash_range(cellMapping.begin(), cellMapping.end());
-                writer.write(hash, "/", "grid_checksum");
+                writer.write(hash, "/", "grid_checksum", writer.processMode());
+            }
+        }
+        // Deltas need their full state in the same file,
+        // so they are not used when only the last step is kept.
+        if (saveDeltaInterval_ > 1 && saveStride_ >= 0) {
+            if (!deltaBase_) {
+                deltaBase_ = std::make_unique<HDF5DeltaBase>();
             }
+            writer.setDeltaBase(deltaBase_.get(), saveCount_ % saveDeltaInterval_ == 0);
         }
         simulator_.saveState(writer, groupName);
+        ++saveCount_;
         writer.write(timer, groupName, "simulator_timer",
                      HDF5File::DataSetMode::ROOT_ONLY);
         OpmLog::info("Serialized state written for report step " + std::to_string(nextStep));
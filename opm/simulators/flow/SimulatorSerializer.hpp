@@ -23,11 +23,13 @@
 #include <opm/simulators/utils/ParallelCommunication.hpp>
 
 #include <array>
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace Opm {
 
+struct HDF5DeltaBase;
 class HDF5Serializer;
 class IOConfig;
 class SimulatorTimer;
@@ -62,13 +64,21 @@ public:
     //! \param loadStep Step to load
     //! \param saveFile File to save to
     //! \param loadFile File to load from
+    //! \param saveCollective True to save process data in shared datasets
+    //! \param saveCompressed True to compress saved data
+    //! \param saveDeltaInterval Interval between full saves, with deltas in between
     SimulatorSerializer(SerializableSim& simulator,
                         Parallel::Communication& comm,
                         const IOConfig& ioconfig,
                         const std::string& saveSpec,
                         int loadStep,
                         const std::string& saveFile,
-                        const std::string& loadFile);
+                        const std::string& loadFile,
+                        bool saveCollective = false,
+                        bool saveCompressed = true,
+                        int saveDeltaInterval = 0);
+
+    ~SimulatorSerializer();
 
     //! \brief Returns whether or not a state should be loaded.
     bool shouldLoad() const { return loadStep_ > -1; }
@@ -92,6 +102,7 @@ private:
 
 #if HAVE_HDF5
     SerializableSim& simulator_; //!< Reference to simulator to be use
+    std::unique_ptr<HDF5DeltaBase> deltaBase_; //!< Chunk hashes of the last full state for delta saves
 #endif // HAVE_HDF5
     Parallel::Communication& comm_; //!< Communication to use
     int saveStride_ = 0; //!< Stride to save serialized state at, negative to only keep last
@@ -99,6 +110,10 @@ private:
     int loadStep_ = -1; //!< Step to load serialized state from
     std::string saveFile_; //!< File to save serialized state to
     std::string loadFile_; //!< File to load serialized state from
+    bool saveCollective_; //!< True to save process data in shared datasets
+    bool saveCompressed_; //!< True to compress saved data
+    int saveDeltaInterval_; //!< Interval between full saves when saving deltas
+    int saveCount_ = 0; //!< Number of states saved to the current file
 };
 
 } // namespace Opm
@@ -32,7 +32,10 @@ namespace Opm
     //! \brief Solver approach for NLDD.
     enum class DomainSolveApproach {
         Jacobi,
-        GaussSeidel
+        GaussSeidel,
+        //! Gauss-Seidel over colours of the subdomain graph, the
+        //! subdomains of one colour are solved concurrently.
+        ColouredGaussSeidel
     };
 
     //! \brief Measure to use for domain ordering.
@@ -34,6 +34,7 @@
 #include <opm/grid/common/CartesianIndexMapper.hpp>
 #include <opm/grid/LookUpData.hh>
 
+#include <opm/simulators/utils/FlatIdMap.hpp>
 
 #include <array>
 #include <functional>
@@ -160,6 +161,19 @@ public:
     void update(bool global, TransUpdateQuantities update_quantities = TransUpdateQuantities::All,
                 const std::function<unsigned int(unsigned int)>& map = {}, bool applyNncMultRegT = false);
 
+    /// \brief Keep the face geometry between calls to update().
+    ///
+    /// By default the face table is released at the end of update(). Keeping
+    /// it makes later updates, e.g., after the schedule changes multipliers,
+    /// skip the grid traversal. The grid must not change while it is kept.
+    void setKeepFaceTable(bool keep)
+    {
+        keepFaceTable_ = keep;
+        if (!keep) {
+            faceTable_ = FaceTable{};
+        }
+    }
+
 protected:
     void updateFromEclState_(bool global);
 
@@ -173,6 +187,58 @@ protected:
         unsigned cartElemIdx;
     };
 
+    /// \brief Geometry of the grid faces, as needed by update().
+    ///
+    /// The faces are extracted from the grid, and the cell properties and
+    /// multipliers are then evaluated over these flat arrays. If requested
+    /// by setKeepFaceTable(), the table is reused by later updates. The
+    /// faces are stored in the order the grid is traversed.
+    struct FaceTable
+    {
+        /// \brief One side of the faces, as seen from the cell on that side.
+        struct Side
+        {
+            std::vector<unsigned> elemIdx;
+            std::vector<unsigned> cartElemIdx;
+            std::vector<int> faceIdx; //!< Face index in the cell, -1 for NNCs
+            std::vector<Scalar> normalDotDist; //!< |faceAreaNormal . distance|
+            std::vector<Scalar> dist2; //!< |distance|^2, distance from cell to face center
+
+            std::size_t size() const { return elemIdx.size(); }
+
+            void push_back(unsigned elem, unsigned cartElem, int face,
+                           Scalar dot, Scalar d2)
+            {
+                elemIdx.push_back(elem);
+                cartElemIdx.push_back(cartElem);
+                faceIdx.push_back(face);
+                normalDotDist.push_back(dot);
+                dist2.push_back(d2);
+            }
+
+            void append(const Side& other)
+            {
+                elemIdx.insert(elemIdx.end(), other.elemIdx.begin(), other.elemIdx.end());
+                cartElemIdx.insert(cartElemIdx.end(), other.cartElemIdx.begin(), other.cartElemIdx.end());
+                faceIdx.insert(faceIdx.end(), other.faceIdx.begin(), other.faceIdx.end());
+                normalDotDist.insert(normalDotDist.end(), other.normalDotDist.begin(), other.normalDotDist.end());
+                dist2.insert(dist2.end(), other.dist2.begin(), other.dist2.end());
+            }
+        };
+
+        Side inside;  //!< Inside of the faces between two cells, stored once per face
+        Side outside; //!< Outside of the faces between two cells
+        Side boundary; //!< Faces on the domain boundary
+        std::vector<unsigned> boundaryIsIdx; //!< Intersection index of the boundary faces
+        unsigned numElements = 0; //!< Number of elements the table was built for
+    };
+
+    /// \brief Extract the face geometry from the grid into faceTable_.
+    ///
+    /// \param elemMapper Mapper for the elements of the grid view
+    /// \param num_threads Number of threads to use
+    void buildFaceTable_(const ElementMapper& elemMapper, int num_threads);
+
     /// \brief Apply the Multipliers for the case PINCH(4)==TOPBOT
     ///
     /// \param trans Resulting transmissibility
@@ -281,13 +347,15 @@ protected:
     std::vector<DimMatrix> permeability_;
     std::vector<Scalar> porosity_;
     std::vector<Scalar> dispersion_;
-    std::unordered_map<std::uint64_t, Scalar> trans_;
+    FlatIdMap<Scalar> trans_;
     const EclipseState& eclState_;
     const GridView& gridView_;
     const CartesianIndexMapper& cartMapper_;
     const Grid& grid_;
     std::function<std::array<double,dimWorld>(int)> centroids_;
     std::vector<std::array<double,dimWorld>> centroids_cache_;
+    FaceTable faceTable_;
+    bool keepFaceTable_ = false;
     Scalar transmissibilityThreshold_;
     std::map<std::pair<unsigned, unsigned>, Scalar> transBoundary_;
     std::map<std::pair<unsigned, unsigned>, Scalar> thermalHalfTransBoundary_;
@@ -295,9 +363,9 @@ protected:
     bool enableDiffusivity_;
     bool enableDispersivity_;
     bool warnEditNNC_ = true;
-    std::unordered_map<std::uint64_t, Scalar> thermalHalfTrans_; //NB this is based on direction map size is ca 2*trans_ (diffusivity_)
-    std::unordered_map<std::uint64_t, Scalar> diffusivity_;
-    std::unordered_map<std::uint64_t, Scalar> dispersivity_;
+    FlatIdMap<Scalar> thermalHalfTrans_; //NB this is based on direction map size is ca 2*trans_ (diffusivity_)
+    FlatIdMap<Scalar> diffusivity_;
+    FlatIdMap<Scalar> dispersivity_;
 
     const LookUpData<Grid,GridView> lookUpData_;
     const LookUpCartesianData<Grid,GridView> lookUpCartesianData_;
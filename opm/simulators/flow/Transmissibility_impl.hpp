@@ -262,11 +262,9 @@ update(bool global, const TransUpdateQuantities update_quantities,
         comm.broadcast(&pinchActive, 1, 0);
     }
 
-    // fill the centroids cache to avoid repeated calculations in loops below
-    centroids_cache_.resize(gridView_.size(0));
-    for (const auto& elem : elements(gridView_)) {
-        const unsigned elemIdx = elemMapper.index(elem);
-        centroids_cache_[elemIdx] = centroids_(elemIdx);
+    // the face geometry is only extracted again if it was not kept
+    if (faceTable_.numElements != numElements) {
+        buildFaceTable_(elemMapper, num_threads);
     }
 
     auto harmonicMean = [](const Scalar x1, const Scalar x2)
@@ -294,14 +292,25 @@ update(bool global, const TransUpdateQuantities update_quantities,
         }
     };
 
-    auto halfDiff = [](const DimVector& faceAreaNormal,
-                       const unsigned,
-                       const DimVector& distVector,
-                       const Scalar prop)
+    // half transmissibility or diffusivity of face i on the given side,
+    // evaluated as in computeHalfTrans_() and computeHalfDiffusivity_()
+    auto half = [](const typename FaceTable::Side& side,
+                   const std::size_t i,
+                   const Scalar prop)
     {
-        return computeHalfDiffusivity_(faceAreaNormal,
-                                       distVector,
-                                       prop);
+        Scalar value = prop;
+        value *= side.normalDotDist[i];
+        value /= side.dist2[i];
+        return value;
+    };
+
+    auto halfPerm = [this](const typename FaceTable::Side& side,
+                           const std::size_t i)
+    {
+        assert(side.faceIdx[i] >= 0);
+        const unsigned dimIdx = side.faceIdx[i] / 2;
+        assert(dimIdx < dimWorld);
+        return permeability_[side.elemIdx[i]][dimIdx][dimIdx];
     };
 
     ThreadSafeMapBuilder transBoundary(transBoundary_, num_threads,
@@ -319,217 +328,141 @@ update(bool global, const TransUpdateQuantities update_quantities,
 
     const auto& nnc_input = eclState_.getInputNNC().input();
 
+    // grid boundary faces
+    const auto& boundary = faceTable_.boundary;
+    const std::size_t numBoundaryFaces = boundary.size();
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for schedule(static)
 #endif
-    for (const auto& chunk : ElementChunks(gridView_, Dune::Partitions::all, num_threads)) {
-        for (const auto& elem : chunk) {
-            FaceInfo inside;
-            FaceInfo outside;
-            DimVector faceAreaNormal;
-
-            inside.elemIdx = elemMapper.index(elem);
-            // Get the Cartesian index of the origin cells (parent or equivalent cell on level zero),
-            // for CpGrid with LGRs. For general grids and no LGRs, get the usual Cartesian Index.
-            inside.cartElemIdx = this->lookUpCartesianData_.
-                template getFieldPropCartesianIdx<Grid>(inside.elemIdx);
-
-            auto computeHalf = [this, &faceAreaNormal, &inside, &outside]
-                               (const auto& halfComputer,
-                                const auto& prop1, const auto& prop2) -> std::array<Scalar,2>
-            {
-                return {
-                    halfComputer(faceAreaNormal,
-                                 inside.faceIdx,
-                                 distanceVector_(inside.faceCenter, inside.elemIdx),
-                                 prop1),
-                    halfComputer(faceAreaNormal,
-                                 outside.faceIdx,
-                                 distanceVector_(outside.faceCenter, outside.elemIdx),
-                                 prop2)
-                };
-            };
-
-            auto computeHalfMean = [&inside, &outside, &computeHalf, &ntg, &harmonicMean]
-                                   (const auto& halfComputer, const auto& prop)
-            {
-                auto onesided = computeHalf(halfComputer, prop[inside.elemIdx], prop[outside.elemIdx]);
-                applyNtg_(onesided[0], inside, ntg);
-                applyNtg_(onesided[1], outside, ntg);
-
-                //TODO Add support for multipliers
-                return harmonicMean(onesided[0], onesided[1]);
-            };
-
-            unsigned boundaryIsIdx = 0;
-            for (const auto& intersection : intersections(gridView_, elem)) {
-                // deal with grid boundaries
-                if (intersection.boundary()) {
-                    // compute the transmissibilty for the boundary intersection
-                    const auto& geometry = intersection.geometry();
-                    inside.faceCenter = geometry.center();
-
-                    faceAreaNormal = intersection.centerUnitOuterNormal();
-                    faceAreaNormal *= geometry.volume();
-
-                    Scalar transBoundaryIs =
-                        computeHalfTrans_(faceAreaNormal,
-                                          intersection.indexInInside(),
-                                          distanceVector_(inside.faceCenter, inside.elemIdx),
-                                          permeability_[inside.elemIdx]);
-
-                    // normally there would be two half-transmissibilities that would be
-                    // averaged. on the grid boundary there only is the half
-                    // transmissibility of the interior element.
-                    applyMultipliers_(transBoundaryIs, intersection.indexInInside(), inside.cartElemIdx, transMult);
-                    transBoundary.insert_or_assign(std::make_pair(inside.elemIdx, boundaryIsIdx), transBoundaryIs);
-
-                    // for boundary intersections we also need to compute the thermal
-                    // half transmissibilities
-                    if (enableEnergy_ && !onlyTrans) {
-                        Scalar transBoundaryEnergyIs =
-                            computeHalfDiffusivity_(faceAreaNormal,
-                                                    distanceVector_(inside.faceCenter, inside.elemIdx),
-                                                    1.0);
-                        thermalHalfTransBoundary.insert_or_assign(std::make_pair(inside.elemIdx, boundaryIsIdx),
-                                                                   transBoundaryEnergyIs);
-                    }
-
-                    ++boundaryIsIdx;
-                    continue;
-                }
-
-                if (!intersection.neighbor()) {
-                    // elements can be on process boundaries, i.e. they are not on the
-                    // domain boundary yet they don't have neighbors.
-                    ++boundaryIsIdx;
-                    continue;
-                }
-
-                const auto& outsideElem = intersection.outside();
-                outside.elemIdx = elemMapper.index(outsideElem);
-
-                // Get the Cartesian index of the origin cells (parent or equivalent cell on level zero),
-                // for CpGrid with LGRs. For general grids and no LGRs, get the usual Cartesian Index.
-                outside.cartElemIdx =  this->lookUpCartesianData_.
-                    template getFieldPropCartesianIdx<Grid>(outside.elemIdx);
-
-                // we only need to calculate a face's transmissibility
-                // once...
-                // In a parallel run inside.cartElemIdx > outside.cartElemIdx does not imply inside.elemIdx > outside.elemIdx for
-                // ghost cells and we need to use the cartesian index as this will be used when applying Z multipliers
-                // To cover the case where both cells are part of an LGR and as a consequence might have
-                // the same cartesian index, we tie their Cartesian indices and the ones on the leaf grid view.
-                if (std::tie(inside.cartElemIdx, inside.elemIdx) > std::tie(outside.cartElemIdx, outside.elemIdx)) {
-                    continue;
-                }
-
-                // local indices of the faces of the inside and
-                // outside elements which contain the intersection
-                inside.faceIdx  = intersection.indexInInside();
-                outside.faceIdx = intersection.indexInOutside();
+    for (std::size_t i = 0; i < numBoundaryFaces; ++i) {
+        // normally there would be two half-transmissibilities that would be
+        // averaged. on the grid boundary there only is the half
+        // transmissibility of the interior element.
+        Scalar transBoundaryIs = half(boundary, i, halfPerm(boundary, i));
+        applyMultipliers_(transBoundaryIs, boundary.faceIdx[i], boundary.cartElemIdx[i], transMult);
+        const auto key = std::make_pair(boundary.elemIdx[i], faceTable_.boundaryIsIdx[i]);
+        transBoundary.insert_or_assign(key, transBoundaryIs);
+
+        // for boundary intersections we also need to compute the thermal
+        // half transmissibilities
+        if (enableEnergy_ && !onlyTrans) {
+            thermalHalfTransBoundary.insert_or_assign(key, half(boundary, i, 1.0));
+        }
+    }
 
-                if (inside.faceIdx == -1) {
-                    // NNC. Set zero transmissibility, as it will be
-                    // *added to* by applyNncToGridTrans_() later.
-                    assert(outside.faceIdx == -1);
-                    transMap.insert_or_assign(details::isId(inside.elemIdx, outside.elemIdx), 0.0);
-                    if (enableEnergy_ && !onlyTrans) {
-                        thermalHalfTrans.insert_or_assign(details::directionalIsId(inside.elemIdx, outside.elemIdx), 0.0);
-                        thermalHalfTrans.insert_or_assign(details::directionalIsId(outside.elemIdx, inside.elemIdx), 0.0);
-                    }
-
-                    if (updateDiffusivity && !onlyTrans) {
-                        diffusivity.insert_or_assign(details::isId(inside.elemIdx, outside.elemIdx), 0.0);
-                    }
-                    if (updateDispersivity && !onlyTrans) {
-                        dispersivity.insert_or_assign(details::isId(inside.elemIdx, outside.elemIdx), 0.0);
-                    }
-                    continue;
-                }
+    // faces between two cells. The static schedule keeps the grid order
+    // of the insertions when the thread local maps are merged.
+    const auto& in = faceTable_.inside;
+    const auto& out = faceTable_.outside;
+    const std::size_t numFaces = in.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (std::size_t i = 0; i < numFaces; ++i) {
+        const FaceInfo inside{DimVector{}, in.faceIdx[i], in.elemIdx[i], in.cartElemIdx[i]};
+        const FaceInfo outside{DimVector{}, out.faceIdx[i], out.elemIdx[i], out.cartElemIdx[i]};
+
+        if (inside.faceIdx == -1) {
+            // NNC. Set zero transmissibility, as it will be
+            // *added to* by applyNncToGridTrans_() later.
+            assert(outside.faceIdx == -1);
+            transMap.insert_or_assign(details::isId(inside.elemIdx, outside.elemIdx), 0.0);
+            if (enableEnergy_ && !onlyTrans) {
+                thermalHalfTrans.insert_or_assign(details::directionalIsId(inside.elemIdx, outside.elemIdx), 0.0);
+                thermalHalfTrans.insert_or_assign(details::directionalIsId(outside.elemIdx, inside.elemIdx), 0.0);
+            }
 
-                typename std::is_same<Grid, Dune::CpGrid>::type isCpGrid;
-                computeFaceProperties(intersection,
-                                      inside,
-                                      outside,
-                                      faceAreaNormal,
-                                      isCpGrid);
+            if (updateDiffusivity && !onlyTrans) {
+                diffusivity.insert_or_assign(details::isId(inside.elemIdx, outside.elemIdx), 0.0);
+            }
+            if (updateDispersivity && !onlyTrans) {
+                dispersivity.insert_or_assign(details::isId(inside.elemIdx, outside.elemIdx), 0.0);
+            }
+            continue;
+        }
 
-                Scalar trans = computeHalfMean(computeHalfTrans_, permeability_);
-
-                // apply the full face transmissibility multipliers
-                // for the inside ...
-                if (!pinchActive) {
-                    if (inside.faceIdx > 3) { // top or bottom
-                         auto find_layer = [&cartDims](std::size_t cell) {
-                            cell /= cartDims[0];
-                            auto k = cell / cartDims[1];
-                            return k;
-                        };
-                        int kup = find_layer(inside.cartElemIdx);
-                        int kdown = find_layer(outside.cartElemIdx);
-                        // When a grid is a CpGrid with LGRs, insideCartElemIdx coincides with outsideCartElemIdx
-                        // for cells on the leaf with the same parent cell on level zero.
-                        assert((kup != kdown) || (inside.cartElemIdx == outside.cartElemIdx));
-                        if (std::abs(kup -kdown) > 1) {
-                            trans = 0.0;
-                        }
-                    }
+        auto halfMean = [&](const Scalar propIn, const Scalar propOut)
+        {
+            Scalar halfIn = half(in, i, propIn);
+            Scalar halfOut = half(out, i, propOut);
+            applyNtg_(halfIn, inside, ntg);
+            applyNtg_(halfOut, outside, ntg);
+
+            //TODO Add support for multipliers
+            return harmonicMean(halfIn, halfOut);
+        };
+
+        Scalar trans = halfMean(halfPerm(in, i), halfPerm(out, i));
+
+        // apply the full face transmissibility multipliers
+        // for the inside ...
+        if (!pinchActive) {
+            if (inside.faceIdx > 3) { // top or bottom
+                 auto find_layer = [&cartDims](std::size_t cell) {
+                    cell /= cartDims[0];
+                    auto k = cell / cartDims[1];
+                    return k;
+                };
+                int kup = find_layer(inside.cartElemIdx);
+                int kdown = find_layer(outside.cartElemIdx);
+                // When a grid is a CpGrid with LGRs, insideCartElemIdx coincides with outsideCartElemIdx
+                // for cells on the leaf with the same parent cell on level zero.
+                assert((kup != kdown) || (inside.cartElemIdx == outside.cartElemIdx));
+                if (std::abs(kup -kdown) > 1) {
+                    trans = 0.0;
                 }
+            }
+        }
 
-                if (useSmallestMultiplier) {
-                    //  PINCH(4) == TOPBOT is assumed here as we set useSmallestMultipliers
-                    // to false if  PINCH(4) == ALL holds
-                    // In contrast to the name this will also apply
-                    applyAllZMultipliers_(trans, inside, outside, transMult, cartDims);
-                }
-                else {
-                    applyMultipliers_(trans, inside.faceIdx, inside.cartElemIdx, transMult);
-                    // ... and outside elements
-                    applyMultipliers_(trans, outside.faceIdx, outside.cartElemIdx, transMult);
-                }
+        if (useSmallestMultiplier) {
+            //  PINCH(4) == TOPBOT is assumed here as we set useSmallestMultipliers
+            // to false if  PINCH(4) == ALL holds
+            // In contrast to the name this will also apply
+            applyAllZMultipliers_(trans, inside, outside, transMult, cartDims);
+        }
+        else {
+            applyMultipliers_(trans, inside.faceIdx, inside.cartElemIdx, transMult);
+            // ... and outside elements
+            applyMultipliers_(trans, outside.faceIdx, outside.cartElemIdx, transMult);
+        }
 
-                bool foundInputNNC = false;
-                if (! nnc_input.empty()) {
-                    // Skip region multipliers for overlapping input NNCs (they are handled later)
-                    auto it = std::lower_bound(nnc_input.begin(), nnc_input.end(),
-                                               NNCdata { inside.cartElemIdx, outside.cartElemIdx, 0.0 });
-                    foundInputNNC = it != nnc_input.end() && it->cell1 == inside.cartElemIdx && it->cell2 == outside.cartElemIdx;
-                }
-                if (! foundInputNNC) {
-                    // apply the region multipliers (cf. the MULTREGT keyword)
-                    trans *= transMult.getRegionMultiplier(inside.cartElemIdx,
-                                                           outside.cartElemIdx,
-                                                           faceIdToDir(inside.faceIdx));
-                }
+        bool foundInputNNC = false;
+        if (! nnc_input.empty()) {
+            // Skip region multipliers for overlapping input NNCs (they are handled later)
+            auto it = std::lower_bound(nnc_input.begin(), nnc_input.end(),
+                                       NNCdata { inside.cartElemIdx, outside.cartElemIdx, 0.0 });
+            foundInputNNC = it != nnc_input.end() && it->cell1 == inside.cartElemIdx && it->cell2 == outside.cartElemIdx;
+        }
+        if (! foundInputNNC) {
+            // apply the region multipliers (cf. the MULTREGT keyword)
+            trans *= transMult.getRegionMultiplier(inside.cartElemIdx,
+                                                   outside.cartElemIdx,
+                                                   faceIdToDir(inside.faceIdx));
+        }
 
-                transMap.insert_or_assign(details::isId(inside.elemIdx, outside.elemIdx), trans);
+        transMap.insert_or_assign(details::isId(inside.elemIdx, outside.elemIdx), trans);
 
-                // update the "thermal half transmissibility" for the intersection
-                if (enableEnergy_ && !onlyTrans) {
-                    const auto half = computeHalf(halfDiff, 1.0, 1.0);
-                    // TODO Add support for multipliers
-                    thermalHalfTrans.insert_or_assign(details::directionalIsId(inside.elemIdx, outside.elemIdx),
-                                                      half[0]);
-                    thermalHalfTrans.insert_or_assign(details::directionalIsId(outside.elemIdx, inside.elemIdx),
-                                                      half[1]);
-                }
+        // update the "thermal half transmissibility" for the intersection
+        if (enableEnergy_ && !onlyTrans) {
+            // TODO Add support for multipliers
+            thermalHalfTrans.insert_or_assign(details::directionalIsId(inside.elemIdx, outside.elemIdx),
+                                              half(in, i, 1.0));
+            thermalHalfTrans.insert_or_assign(details::directionalIsId(outside.elemIdx, inside.elemIdx),
+                                              half(out, i, 1.0));
+        }
 
-                // update the "diffusive half transmissibility" for the intersection
-                if (updateDiffusivity && !onlyTrans) {
-                    diffusivity.insert_or_assign(details::isId(inside.elemIdx, outside.elemIdx),
-                                                 computeHalfMean(halfDiff, porosity_));
-                }
+        // update the "diffusive half transmissibility" for the intersection
+        if (updateDiffusivity && !onlyTrans) {
+            diffusivity.insert_or_assign(details::isId(inside.elemIdx, outside.elemIdx),
+                                         halfMean(porosity_[inside.elemIdx], porosity_[outside.elemIdx]));
+        }
 
-                // update the "dispersivity half transmissibility" for the intersection
-                if (updateDispersivity && !onlyTrans) {
-                    dispersivity.insert_or_assign(details::isId(inside.elemIdx, outside.elemIdx),
-                                                  computeHalfMean(halfDiff, dispersion_));
-                }
-            }
+        // update the "dispersivity half transmissibility" for the intersection
+        if (updateDispersivity && !onlyTrans) {
+            dispersivity.insert_or_assign(details::isId(inside.elemIdx, outside.elemIdx),
+                                          halfMean(dispersion_[inside.elemIdx], dispersion_[outside.elemIdx]));
         }
     }
-    centroids_cache_.clear();
 
 #ifdef _OPENMP
 #pragma omp parallel sections
@@ -561,6 +494,10 @@ update(bool global, const TransUpdateQuantities update_quantities,
         dispersivity.finalize();
     }
 
+    if (!keepFaceTable_) {
+        faceTable_ = FaceTable{};
+    }
+
     // Potentially overwrite and/or modify transmissibilities based on input from deck
     this->updateFromEclState_(global);
 
@@ -595,6 +532,129 @@ update(bool global, const TransUpdateQuantities update_quantities,
     this->removeNonCartesianTransmissibilities_(disableNNC);
 }
 
+template<class Grid, class GridView, class ElementMapper, class CartesianIndexMapper, class Scalar>
+void Transmissibility<Grid,GridView,ElementMapper,CartesianIndexMapper,Scalar>::
+buildFaceTable_(const ElementMapper& elemMapper, const int num_threads)
+{
+    // fill the centroids cache to avoid repeated calculations in loops below
+    centroids_cache_.resize(gridView_.size(0));
+    for (const auto& elem : elements(gridView_)) {
+        const unsigned elemIdx = elemMapper.index(elem);
+        centroids_cache_[elemIdx] = centroids_(elemIdx);
+    }
+
+    auto addSide = [this](typename FaceTable::Side& side,
+                          const FaceInfo& face,
+                          const DimVector& faceAreaNormal)
+    {
+        const DimVector dist = distanceVector_(face.faceCenter, face.elemIdx);
+        side.push_back(face.elemIdx, face.cartElemIdx, face.faceIdx,
+                       std::abs(Dune::dot(faceAreaNormal, dist)),
+                       dist.two_norm2());
+    };
+
+    // With a static schedule each thread gets consecutive chunks, so
+    // appending the thread tables in order gives the grid order.
+    std::vector<FaceTable> threadTables(num_threads);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (const auto& chunk : ElementChunks(gridView_, Dune::Partitions::all, num_threads)) {
+        auto& table = threadTables[ThreadManager::threadId()];
+        for (const auto& elem : chunk) {
+            FaceInfo inside;
+            FaceInfo outside;
+            DimVector faceAreaNormal;
+
+            inside.elemIdx = elemMapper.index(elem);
+            // Get the Cartesian index of the origin cells (parent or equivalent cell on level zero),
+            // for CpGrid with LGRs. For general grids and no LGRs, get the usual Cartesian Index.
+            inside.cartElemIdx = this->lookUpCartesianData_.
+                template getFieldPropCartesianIdx<Grid>(inside.elemIdx);
+
+            unsigned boundaryIsIdx = 0;
+            for (const auto& intersection : intersections(gridView_, elem)) {
+                // deal with grid boundaries
+                if (intersection.boundary()) {
+                    const auto& geometry = intersection.geometry();
+                    inside.faceCenter = geometry.center();
+                    inside.faceIdx = intersection.indexInInside();
+
+                    faceAreaNormal = intersection.centerUnitOuterNormal();
+                    faceAreaNormal *= geometry.volume();
+
+                    addSide(table.boundary, inside, faceAreaNormal);
+                    table.boundaryIsIdx.push_back(boundaryIsIdx);
+
+                    ++boundaryIsIdx;
+                    continue;
+                }
+
+                if (!intersection.neighbor()) {
+                    // elements can be on process boundaries, i.e. they are not on the
+                    // domain boundary yet they don't have neighbors.
+                    ++boundaryIsIdx;
+                    continue;
+                }
+
+                const auto& outsideElem = intersection.outside();
+                outside.elemIdx = elemMapper.index(outsideElem);
+
+                // Get the Cartesian index of the origin cells (parent or equivalent cell on level zero),
+                // for CpGrid with LGRs. For general grids and no LGRs, get the usual Cartesian Index.
+                outside.cartElemIdx =  this->lookUpCartesianData_.
+                    template getFieldPropCartesianIdx<Grid>(outside.elemIdx);
+
+                // we only need to calculate a face's transmissibility
+                // once...
+                // In a parallel run inside.cartElemIdx > outside.cartElemIdx does not imply inside.elemIdx > outside.elemIdx for
+                // ghost cells and we need to use the cartesian index as this will be used when applying Z multipliers
+                // To cover the case where both cells are part of an LGR and as a consequence might have
+                // the same cartesian index, we tie their Cartesian indices and the ones on the leaf grid view.
+                if (std::tie(inside.cartElemIdx, inside.elemIdx) > std::tie(outside.cartElemIdx, outside.elemIdx)) {
+                    continue;
+                }
+
+                // local indices of the faces of the inside and
+                // outside elements which contain the intersection
+                inside.faceIdx  = intersection.indexInInside();
+                outside.faceIdx = intersection.indexInOutside();
+
+                if (inside.faceIdx == -1) {
+                    // NNC, there is no face geometry
+                    assert(outside.faceIdx == -1);
+                    table.inside.push_back(inside.elemIdx, inside.cartElemIdx, -1, 0.0, 1.0);
+                    table.outside.push_back(outside.elemIdx, outside.cartElemIdx, -1, 0.0, 1.0);
+                    continue;
+                }
+
+                typename std::is_same<Grid, Dune::CpGrid>::type isCpGrid;
+                computeFaceProperties(intersection,
+                                      inside,
+                                      outside,
+                                      faceAreaNormal,
+                                      isCpGrid);
+
+                addSide(table.inside, inside, faceAreaNormal);
+                addSide(table.outside, outside, faceAreaNormal);
+            }
+        }
+    }
+    centroids_cache_.clear();
+
+    faceTable_ = FaceTable{};
+    for (const auto& table : threadTables) {
+        faceTable_.inside.append(table.inside);
+        faceTable_.outside.append(table.outside);
+        faceTable_.boundary.append(table.boundary);
+        faceTable_.boundaryIsIdx.insert(faceTable_.boundaryIsIdx.end(),
+                                        table.boundaryIsIdx.begin(),
+                                        table.boundaryIsIdx.end());
+    }
+    faceTable_.numElements = gridView_.size(0);
+}
+
 template<class Grid, class GridView, class ElementMapper, class CartesianIndexMapper, class Scalar>
 void Transmissibility<Grid,GridView,ElementMapper,CartesianIndexMapper,Scalar>::
 extractPermeability_()
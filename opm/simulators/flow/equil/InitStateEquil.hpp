@@ -34,10 +34,13 @@
 #include <opm/material/common/Tabulated1DFunction.hpp>
 #include <opm/material/fluidstates/SimpleModularFluidState.hpp>
 
+#include <opm/simulators/flow/equil/PressureTableCache.hpp>
+
 #include <opm/simulators/utils/ParallelCommunication.hpp>
 
 #include <array>
 #include <cstddef>
+#include <iosfwd>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -84,8 +87,14 @@ public:
            const Scalar y0,
            const int N);
 
+    /// Restore a solution with \p N steps stored by write().
+    RK4IVP(std::istream& is, const int N);
+
     Scalar operator()(const Scalar x) const;
 
+    /// Write the sampled solution in binary form.
+    void write(std::ostream& os) const;
+
 private:
     int N_;
     std::array<Scalar,2> span_;
@@ -224,6 +233,20 @@ public:
     void equilibrate(const Region& reg,
                      const VSpan&  span);
 
+    /// Write the equilibrated phase pressure tables in binary form.
+    ///
+    /// \param[in,out] os Output stream.
+    void write(std::ostream& os) const;
+
+    /// Restore phase pressure tables stored by write() instead of
+    /// calling equilibrate().
+    ///
+    /// \param[in,out] is Input stream.
+    ///
+    /// \return Whether or not \p is held a complete set of tables for
+    ///    the active phases.  The object is unchanged otherwise.
+    bool read(std::istream& is);
+
     /// Predicate for whether or not oil is an active phase
     bool oilActive() const;
 
@@ -275,6 +298,8 @@ private:
                                   const int       nsample,
                                   const VSpan&    span);
 
+        PressureFunction(std::istream& is, const int nsample);
+
         PressureFunction(const PressureFunction& rhs);
 
         PressureFunction(PressureFunction&& rhs) = default;
@@ -285,6 +310,8 @@ private:
 
         Scalar value(const Scalar depth) const;
 
+        void write(std::ostream& os) const;
+
     private:
         enum Direction : std::size_t { Up, Down, NumDir };
 
@@ -713,7 +740,8 @@ public:
                          const CartesianIndexMapper& cartMapper,
                          const Scalar grav,
                          const int num_pressure_points = 2000,
-                         const bool applySwatInit = true);
+                         const bool applySwatInit = true,
+                         const std::string& pressureTableCache = "");
 
     using Vec = std::vector<Scalar>;
     using PVec = std::vector<Vec>; // One per phase.
@@ -755,8 +783,12 @@ private:
                           const Comm& comm,
                           const Scalar grav);
 
-    template <class CellRange, class EquilibrationMethod>
+    /// Run an equilibration method on all cells of a region.  The cells
+    /// are processed concurrently, each thread with its own copy of the
+    /// saturation calculator \p psat.
+    template <class CellRange, class PhaseSat, class EquilibrationMethod>
     void cellLoop(const CellRange&      cells,
+                  const PhaseSat&       psat,
                   EquilibrationMethod&& eqmethod);
 
     template <class CellRange, class PressTable, class PhaseSat>
@@ -773,15 +805,15 @@ private:
                                PhaseSat&               psat);
 
      template<class CellRange, class PressTable, class PhaseSat>
-     void equilibrateTiltedFaultBlock(const CellRange& cells, 
+     void equilibrateTiltedFaultBlock(const CellRange& cells,
                             const EquilReg<Scalar>& eqreg,
-                            const GridView& gridView, const int numLevels,
+                            const std::vector<Element>& entityMap, const int numLevels,
                             const PressTable& ptable, PhaseSat& psat);
 
      template<class CellRange, class PressTable, class PhaseSat>
      void equilibrateTiltedFaultBlockSimple(const CellRange& cells,
                            const EquilReg<Scalar>& eqreg,
-                           const GridView& gridView, const int numLevels,
+                           const int numLevels,
                            const PressTable& ptable, PhaseSat& psat);
 
     std::vector< std::shared_ptr<Miscibility::RsFunction<Scalar>> > rsFunc_;
@@ -808,6 +840,7 @@ private:
     std::vector<std::pair<Scalar,Scalar>> cellZMinMax_;
     std::vector<CellCornerData<Scalar>> cellCorners_;
     int num_pressure_points_;
+    Details::PressureTableCache pressureTableCache_;
 };
 
 } // namespace DeckDependent
@@ -56,8 +56,14 @@
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <istream>
+#include <iterator>
 #include <limits>
 #include <numbers>
+#include <ostream>
+#include <sstream>
 #include <stdexcept>
 
 namespace Opm {
@@ -315,6 +321,18 @@ Scalar calculateTrueVerticalDepth(Scalar z, Scalar x, Scalar y,
     return tvd;
 }
 
+template <typename T>
+void writeBinary(std::ostream& os, const T& value)
+{
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+void readBinary(std::istream& is, T& value)
+{
+    is.read(reinterpret_cast<char*>(&value), sizeof(T));
+}
+
 template<class Scalar, class RHS>
 RK4IVP<Scalar,RHS>::RK4IVP(const RHS& f,
                            const std::array<Scalar,2>& span,
@@ -349,6 +367,26 @@ RK4IVP<Scalar,RHS>::RK4IVP(const RHS& f,
     assert (y_.size() == typename std::vector<Scalar>::size_type(N + 1));
 }
 
+template<class Scalar, class RHS>
+RK4IVP<Scalar,RHS>::RK4IVP(std::istream& is, const int N)
+    : N_(N)
+    , y_(N + 1)
+    , f_(N + 1)
+{
+    readBinary(is, this->span_);
+    is.read(reinterpret_cast<char*>(this->y_.data()), this->y_.size() * sizeof(Scalar));
+    is.read(reinterpret_cast<char*>(this->f_.data()), this->f_.size() * sizeof(Scalar));
+}
+
+template<class Scalar, class RHS>
+void RK4IVP<Scalar,RHS>::
+write(std::ostream& os) const
+{
+    writeBinary(os, this->span_);
+    os.write(reinterpret_cast<const char*>(this->y_.data()), this->y_.size() * sizeof(Scalar));
+    os.write(reinterpret_cast<const char*>(this->f_.data()), this->f_.size() * sizeof(Scalar));
+}
+
 template<class Scalar, class RHS>
 Scalar RK4IVP<Scalar,RHS>::
 operator()(const Scalar x) const
@@ -588,6 +626,18 @@ PressureFunction<ODE>::PressureFunction(const ODE&      ode,
         (ode, VSpan {{ ic.depth, span[1] }}, ic.pressure, nsample);
 }
 
+template<class FluidSystem, class Region>
+template<class ODE>
+PressureTable<FluidSystem,Region>::
+PressureFunction<ODE>::PressureFunction(std::istream& is,
+                                        const int     nsample)
+{
+    readBinary(is, this->initial_);
+
+    this->value_[Direction::Up] = std::make_unique<Distribution>(is, nsample);
+    this->value_[Direction::Down] = std::make_unique<Distribution>(is, nsample);
+}
+
 template<class FluidSystem, class Region>
 template<class ODE>
 PressureTable<FluidSystem,Region>::
@@ -654,6 +704,18 @@ value(const Scalar depth) const
 }
 
 
+template<class FluidSystem, class Region>
+template<class ODE>
+void PressureTable<FluidSystem,Region>::
+PressureFunction<ODE>::
+write(std::ostream& os) const
+{
+    writeBinary(os, this->initial_);
+
+    this->value_[Direction::Up]->write(os);
+    this->value_[Direction::Down]->write(os);
+}
+
 template<class FluidSystem, class Region>
 template<typename PressFunc>
 void PressureTable<FluidSystem,Region>::
@@ -726,9 +788,11 @@ PhaseSaturations(const PhaseSaturations& rhs)
         , press_    (rhs.press_)
 {
     // Note: We don't need to do anything to the 'fluidState_' here.
-    this->setEvaluationPoint(*rhs.evalPt_.position,
-                             *rhs.evalPt_.region,
-                             *rhs.evalPt_.ptable);
+    if (rhs.evalPt_.position != nullptr) {
+        this->setEvaluationPoint(*rhs.evalPt_.position,
+                                 *rhs.evalPt_.region,
+                                 *rhs.evalPt_.ptable);
+    }
 }
 
 template <class MaterialLawManager, class FluidSystem, class Region, typename CellID>
@@ -1190,6 +1254,62 @@ equilibrate(const Region& reg,
     (this->*equil)(reg, span);
 }
 
+template <class FluidSystem, class Region>
+void PressureTable<FluidSystem,Region>::
+write(std::ostream& os) const
+{
+    const auto writePhase = [&os](const auto& press)
+    {
+        const char present = press != nullptr;
+        writeBinary(os, present);
+        if (present) {
+            press->write(os);
+        }
+    };
+
+    writePhase(this->oil_);
+    writePhase(this->gas_);
+    writePhase(this->wat_);
+}
+
+template <class FluidSystem, class Region>
+bool PressureTable<FluidSystem,Region>::
+read(std::istream& is)
+{
+    const auto readPhase = [&is, this](auto& press)
+    {
+        using PressFunc = typename std::remove_reference_t<decltype(press)>::element_type;
+
+        char present = 0;
+        readBinary(is, present);
+        if (is && present) {
+            press = std::make_unique<PressFunc>(is, this->nsample_);
+        }
+    };
+
+    auto oil = std::unique_ptr<OPress>{};
+    auto gas = std::unique_ptr<GPress>{};
+    auto wat = std::unique_ptr<WPress>{};
+
+    readPhase(oil);
+    readPhase(gas);
+    readPhase(wat);
+
+    if (!is ||
+        (this->oilActive()   && (oil == nullptr)) ||
+        (this->gasActive()   && (gas == nullptr)) ||
+        (this->waterActive() && (wat == nullptr)))
+    {
+        return false;
+    }
+
+    this->oil_ = std::move(oil);
+    this->gas_ = std::move(gas);
+    this->wat_ = std::move(wat);
+
+    return true;
+}
+
 template <class FluidSystem, class Region>
 bool PressureTable<FluidSystem,Region>::
 oilActive() const
@@ -1484,7 +1604,8 @@ InitialStateComputer(MaterialLawManager& materialLawManager,
                      const CartesianIndexMapper& cartMapper,
                      const Scalar grav,
                      const int num_pressure_points,
-                     const bool applySwatInit)
+                     const bool applySwatInit,
+                     const std::string& pressureTableCache)
     : temperature_(grid.size(/*codim=*/0), eclipseState.getTableManager().rtemp()),
       saltConcentration_(grid.size(/*codim=*/0)),
       saltSaturation_(grid.size(/*codim=*/0)),
@@ -1496,7 +1617,8 @@ InitialStateComputer(MaterialLawManager& materialLawManager,
       rv_(grid.size(/*codim=*/0)),
       rvw_(grid.size(/*codim=*/0)),
       cartesianIndexMapper_(cartMapper),
-      num_pressure_points_(num_pressure_points)
+      num_pressure_points_(num_pressure_points),
+      pressureTableCache_(pressureTableCache)
 {
     //Check for presence of kw SWATINIT
     if (applySwatInit) {
@@ -1735,6 +1857,7 @@ InitialStateComputer(MaterialLawManager& materialLawManager,
     updateInitialSaltSaturation_(eclipseState, eqlmap);
 
     // Compute pressures, saturations, rs and rv factors.
+    this->pressureTableCache_.setFluidModel(eclipseState);
     const auto& comm = grid.comm();
     calcPressSatRsRv(eqlmap, rec, materialLawManager, gridView, comm, grav);
 
@@ -2010,66 +2133,142 @@ calcPressSatRsRv(const RMap& reg,
     using PhaseSat = Details::PhaseSaturations<
         MaterialLawManager, FluidSystem, EquilReg<Scalar>, typename RMap::CellId
     >;
+    using PTable = Details::PressureTable<FluidSystem, EquilReg<Scalar>>;
 
-    auto ptable = Details::PressureTable<FluidSystem, EquilReg<Scalar>>{ grav, this->num_pressure_points_ };
-    auto psat   = PhaseSat { materialLawManager, this->swatInit_ };
-    auto vspan  = std::array<Scalar, 2>{};
+    const auto numRegions = static_cast<int>(rec.size());
 
+    // The vertical extents involve collective communication, so they
+    // are computed up front and in the same order on all ranks.
     std::vector<int> regionIsEmpty(rec.size(), 0);
-    for (std::size_t r = 0; r < rec.size(); ++r) {
+    std::vector<std::array<Scalar, 2>> vspan(rec.size());
+    std::vector<EquilReg<Scalar>> eqreg;
+    eqreg.reserve(rec.size());
+    bool needEntityMap = false;
+    for (int r = 0; r < numRegions; ++r) {
         const auto& cells = reg.cells(r);
 
-        Details::verticalExtent(cells, cellZMinMax_, comm, vspan);
+        Details::verticalExtent(cells, cellZMinMax_, comm, vspan[r]);
+
+        eqreg.emplace_back(rec[r], this->rsFunc_[r], this->rvFunc_[r], this->rvwFunc_[r],
+                           this->tempVdTable_[r], this->saltVdTable_[r], this->regionPvtIdx_[r]);
+
+        if (cells.empty()) {
+            regionIsEmpty[r] = 1;
+            continue;
+        }
+
+        // Ensure contacts are within the span
+        vspan[r][0] = std::min(vspan[r][0], std::min(eqreg[r].zgoc(), eqreg[r].zwoc()));
+        vspan[r][1] = std::max(vspan[r][1], std::max(eqreg[r].zgoc(), eqreg[r].zwoc()));
+
+        needEntityMap = needEntityMap || (rec[r].initializationTargetAccuracy() > 0);
+    }
+
+    std::vector<PTable> ptable(rec.size(), PTable { grav, this->num_pressure_points_ });
 
+    // Reuse pressure tables from previous runs with the same fluid model.
+    std::vector<std::uint64_t> cacheKey(rec.size(), 0);
+    std::vector<char> isCached(rec.size(), 0);
+    if (this->pressureTableCache_.enabled()) {
+        for (int r = 0; r < numRegions; ++r) {
+            if (regionIsEmpty[r]) {
+                continue;
+            }
+            cacheKey[r] = this->pressureTableCache_
+                .regionKey(r, rec[r], this->regionPvtIdx_[r], grav,
+                           this->num_pressure_points_,
+                           { vspan[r][0], vspan[r][1] }, sizeof(Scalar));
+            if (const auto data = this->pressureTableCache_.load(cacheKey[r]); data.has_value()) {
+                std::istringstream is(*data);
+                isCached[r] = ptable[r].read(is);
+            }
+        }
+    }
+
+    // The pressure tables of distinct regions are independent, so the
+    // integrations of all regions are run concurrently.
+    std::exception_ptr failure;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int r = 0; r < numRegions; ++r) {
+        if (regionIsEmpty[r] || isCached[r]) {
+            continue;
+        }
+        try {
+            ptable[r].equilibrate(eqreg[r], vspan[r]);
+        }
+        catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(equil_pressure_table_failure)
+#endif
+            if (!failure) {
+                failure = std::current_exception();
+            }
+        }
+    }
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+
+    if (this->pressureTableCache_.enabled()) {
+        int numStored = 0;
+        int numFailed = 0;
+        for (int r = 0; r < numRegions; ++r) {
+            if (regionIsEmpty[r] || isCached[r]) {
+                continue;
+            }
+            std::ostringstream os;
+            ptable[r].write(os);
+            if (this->pressureTableCache_.store(cacheKey[r], os.str())) {
+                ++numStored;
+            } else {
+                ++numFailed;
+            }
+        }
+
+        const auto numCached = comm.sum(static_cast<int>(std::count(isCached.begin(), isCached.end(), 1)));
+        numStored = comm.sum(numStored);
+        numFailed = comm.sum(numFailed);
+        if (comm.rank() == 0) {
+            OpmLog::info(fmt::format("EQUIL pressure table cache: {} tables reused, {} stored",
+                                     numCached, numStored));
+            if (numFailed > 0) {
+                OpmLog::warning(fmt::format("Failed to store {} EQUIL pressure tables in the cache", numFailed));
+            }
+        }
+    }
+
+    // Cell entities by index, for the sub-cell integration of tilted blocks.
+    std::vector<Element> entityMap;
+    if (needEntityMap) {
+        entityMap.resize(gridView.size(0));
+        for (const auto& entity : entities(gridView, Dune::Codim<0>())) {
+            entityMap[gridView.indexSet().index(entity)] = entity;
+        }
+    }
+
+    auto psat = PhaseSat { materialLawManager, this->swatInit_ };
+    for (int r = 0; r < numRegions; ++r) {
+        if (regionIsEmpty[r]) {
+            continue;
+        }
+
+        const auto& cells = reg.cells(r);
         const auto acc = rec[r].initializationTargetAccuracy();
         if (acc > 0) {
             // The grid blocks are treated as being tilted
-            // First check if the region has cells
-            if (cells.empty()) {
-                regionIsEmpty[r] = 1;
-                continue;
-            }
-            const auto eqreg = EquilReg {
-                rec[r], this->rsFunc_[r], this->rvFunc_[r], this->rvwFunc_[r],
-                this->tempVdTable_[r], this->saltVdTable_[r], this->regionPvtIdx_[r]
-            };
-            // Ensure contacts are within the span
-            vspan[0] = std::min(vspan[0], std::min(eqreg.zgoc(), eqreg.zwoc()));
-            vspan[1] = std::max(vspan[1], std::max(eqreg.zgoc(), eqreg.zwoc()));
-            ptable.equilibrate(eqreg, vspan);
             // For titled blocks, we can use a simple weightening based on title of the grid
-            // this->equilibrateTiltedFaultBlockSimple(cells, eqreg, gridView, acc, ptable, psat);
-            this->equilibrateTiltedFaultBlock(cells, eqreg, gridView, acc, ptable, psat);
+            // this->equilibrateTiltedFaultBlockSimple(cells, eqreg[r], acc, ptable[r], psat);
+            this->equilibrateTiltedFaultBlock(cells, eqreg[r], entityMap, acc, ptable[r], psat);
         }
         else if (acc == 0) {
-            if (cells.empty()) {
-                regionIsEmpty[r] = 1;
-                continue;
-            }
-            const auto eqreg = EquilReg {
-                rec[r], this->rsFunc_[r], this->rvFunc_[r], this->rvwFunc_[r],
-                this->tempVdTable_[r], this->saltVdTable_[r], this->regionPvtIdx_[r]
-            };
-            vspan[0] = std::min(vspan[0], std::min(eqreg.zgoc(), eqreg.zwoc()));
-            vspan[1] = std::max(vspan[1], std::max(eqreg.zgoc(), eqreg.zwoc()));
-            ptable.equilibrate(eqreg, vspan);
             // Centre-point method
-            this->equilibrateCellCentres(cells, eqreg, ptable, psat);
+            this->equilibrateCellCentres(cells, eqreg[r], ptable[r], psat);
         }
         else if (acc < 0) {
-            if (cells.empty()) {
-                regionIsEmpty[r] = 1;
-                continue;
-            }
-            const auto eqreg = EquilReg {
-                rec[r], this->rsFunc_[r], this->rvFunc_[r], this->rvwFunc_[r],
-                this->tempVdTable_[r], this->saltVdTable_[r], this->regionPvtIdx_[r]
-            };
-            vspan[0] = std::min(vspan[0], std::min(eqreg.zgoc(), eqreg.zwoc()));
-            vspan[1] = std::max(vspan[1], std::max(eqreg.zgoc(), eqreg.zwoc()));
-            ptable.equilibrate(eqreg, vspan);
             // Horizontal subdivision
-            this->equilibrateHorizontal(cells, eqreg, -acc, ptable, psat);
+            this->equilibrateHorizontal(cells, eqreg[r], -acc, ptable[r], psat);
         }
     }
     comm.min(regionIsEmpty.data(),regionIsEmpty.size());
@@ -2087,13 +2286,14 @@ template<class FluidSystem,
          class GridView,
          class ElementMapper,
          class CartesianIndexMapper>
-template<class CellRange, class EquilibrationMethod>
+template<class CellRange, class PhaseSat, class EquilibrationMethod>
 void InitialStateComputer<FluidSystem,
                           Grid,
                           GridView,
                           ElementMapper,
                           CartesianIndexMapper>::
 cellLoop(const CellRange&      cells,
+         const PhaseSat&       psat,
          EquilibrationMethod&& eqmethod)
 {
     const auto oilPos = FluidSystem::oilPhaseIdx;
@@ -2104,39 +2304,70 @@ cellLoop(const CellRange&      cells,
     const auto gasActive = FluidSystem::phaseIsActive(gasPos);
     const auto watActive = FluidSystem::phaseIsActive(watPos);
 
-    auto pressures   = Details::PhaseQuantityValue<Scalar>{};
-    auto saturations = Details::PhaseQuantityValue<Scalar>{};
-    Scalar Rs          = 0.0;
-    Scalar Rv          = 0.0;
-    Scalar Rvw         = 0.0;
+    const auto numCells = static_cast<int>(std::distance(cells.begin(), cells.end()));
+    std::exception_ptr failure;
 
-    for (const auto& cell : cells) {
-        eqmethod(cell, pressures, saturations, Rs, Rv, Rvw);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        // The saturation calculator holds the state of the current
+        // evaluation point, so each thread needs its own copy.
+        auto localPsat = PhaseSat { psat };
+
+        auto pressures   = Details::PhaseQuantityValue<Scalar>{};
+        auto saturations = Details::PhaseQuantityValue<Scalar>{};
+        Scalar Rs          = 0.0;
+        Scalar Rv          = 0.0;
+        Scalar Rvw         = 0.0;
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int i = 0; i < numCells; ++i) {
+            const auto cell = *(cells.begin() + i);
+            try {
+                eqmethod(cell, localPsat, pressures, saturations, Rs, Rv, Rvw);
+            }
+            catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(equil_cell_loop_failure)
+#endif
+                if (!failure) {
+                    failure = std::current_exception();
+                }
+                continue;
+            }
 
-        if (oilActive) {
-            this->pp_ [oilPos][cell] = pressures.oil;
-            this->sat_[oilPos][cell] = saturations.oil;
-        }
+            if (oilActive) {
+                this->pp_ [oilPos][cell] = pressures.oil;
+                this->sat_[oilPos][cell] = saturations.oil;
+            }
 
-        if (gasActive) {
-            this->pp_ [gasPos][cell] = pressures.gas;
-            this->sat_[gasPos][cell] = saturations.gas;
-        }
+            if (gasActive) {
+                this->pp_ [gasPos][cell] = pressures.gas;
+                this->sat_[gasPos][cell] = saturations.gas;
+            }
 
-        if (watActive) {
-            this->pp_ [watPos][cell] = pressures.water;
-            this->sat_[watPos][cell] = saturations.water;
-        }
+            if (watActive) {
+                this->pp_ [watPos][cell] = pressures.water;
+                this->sat_[watPos][cell] = saturations.water;
+            }
 
-        if (oilActive && gasActive) {
-            this->rs_[cell] = Rs;
-            this->rv_[cell] = Rv;
-        }
+            if (oilActive && gasActive) {
+                this->rs_[cell] = Rs;
+                this->rv_[cell] = Rv;
+            }
 
-        if (watActive && gasActive) {
-            this->rvw_[cell] = Rvw;
+            if (watActive && gasActive) {
+                this->rvw_[cell] = Rvw;
+            }
         }
     }
+
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
 }
 
 template<class FluidSystem,
@@ -2158,8 +2389,9 @@ equilibrateCellCentres(const CellRange&         cells,
     using CellPos = typename PhaseSat::Position;
     using CellID  = std::remove_cv_t<std::remove_reference_t<
         decltype(std::declval<CellPos>().cell)>>;
-    this->cellLoop(cells, [this, &eqreg,  &ptable, &psat]
+    this->cellLoop(cells, psat, [this, &eqreg, &ptable]
         (const CellID                 cell,
+         PhaseSat&                    cellPsat,
          Details::PhaseQuantityValue<Scalar>& pressures,
          Details::PhaseQuantityValue<Scalar>& saturations,
          Scalar&                      Rs,
@@ -2170,8 +2402,8 @@ equilibrateCellCentres(const CellRange&         cells,
             cell, cellCenterDepth_[cell]
         };
 
-        saturations = psat.deriveSaturations(pos, eqreg, ptable);
-        pressures   = psat.correctedPhasePressures();
+        saturations = cellPsat.deriveSaturations(pos, eqreg, ptable);
+        pressures   = cellPsat.correctedPhasePressures();
 
         const auto temp = this->temperature_[cell];
 
@@ -2207,8 +2439,9 @@ equilibrateHorizontal(const CellRange&        cells,
     using CellID  = std::remove_cv_t<std::remove_reference_t<
         decltype(std::declval<CellPos>().cell)>>;
 
-    this->cellLoop(cells, [this, acc, &eqreg, &ptable, &psat]
+    this->cellLoop(cells, psat, [this, acc, &eqreg, &ptable]
         (const CellID                 cell,
+         PhaseSat&                    cellPsat,
          Details::PhaseQuantityValue<Scalar>& pressures,
          Details::PhaseQuantityValue<Scalar>& saturations,
          Scalar&                      Rs,
@@ -2222,8 +2455,8 @@ equilibrateHorizontal(const CellRange&        cells,
         for (const auto& [depth, frac] : Details::horizontalSubdivision(cell, cellZSpan_[cell], acc)) {
             const auto pos = CellPos { cell, depth };
 
-            saturations.axpy(psat.deriveSaturations(pos, eqreg, ptable), frac);
-            pressures  .axpy(psat.correctedPhasePressures(), frac);
+            saturations.axpy(cellPsat.deriveSaturations(pos, eqreg, ptable), frac);
+            pressures  .axpy(cellPsat.correctedPhasePressures(), frac);
 
             totfrac += frac;
         }
@@ -2237,8 +2470,8 @@ equilibrateHorizontal(const CellRange&        cells,
                     cell, cellCenterDepth_[cell]
             };
 
-            saturations = psat.deriveSaturations(pos, eqreg, ptable);
-            pressures   = psat.correctedPhasePressures();
+            saturations = cellPsat.deriveSaturations(pos, eqreg, ptable);
+            pressures   = cellPsat.correctedPhasePressures();
         }
 
         const auto temp = this->temperature_[cell];
@@ -2260,7 +2493,6 @@ template<class CellRange, class PressTable, class PhaseSat>
 void InitialStateComputer<FluidSystem, Grid, GridView, ElementMapper, CartesianIndexMapper>::
 equilibrateTiltedFaultBlockSimple(const CellRange& cells,
                              const EquilReg<Scalar>& eqreg,
-                             const GridView&         gridView,
                              const int               acc,
                              const PressTable&       ptable,
                              PhaseSat&               psat)
@@ -2269,8 +2501,9 @@ equilibrateTiltedFaultBlockSimple(const CellRange& cells,
     using CellID  = std::remove_cv_t<std::remove_reference_t<
         decltype(std::declval<CellPos>().cell)>>;
 
-    this->cellLoop(cells, [this, acc, &eqreg, &ptable, &psat, &gridView]
+    this->cellLoop(cells, psat, [this, acc, &eqreg, &ptable]
         (const CellID                 cell,
+         PhaseSat&                    cellPsat,
          Details::PhaseQuantityValue<Scalar>& pressures,
          Details::PhaseQuantityValue<Scalar>& saturations,
          Scalar&                      Rs,
@@ -2332,8 +2565,8 @@ equilibrateTiltedFaultBlockSimple(const CellRange& cells,
 
             const auto pos = CellPos{cell, tvd};
 
-            auto localSaturations = psat.deriveSaturations(pos, eqreg, ptable);
-            auto localPressures = psat.correctedPhasePressures();
+            auto localSaturations = cellPsat.deriveSaturations(pos, eqreg, ptable);
+            auto localPressures = cellPsat.correctedPhasePressures();
 
             // Apply cross-section weighted averaging
             saturations.axpy(localSaturations, weight);
@@ -2351,8 +2584,8 @@ equilibrateTiltedFaultBlockSimple(const CellRange& cells,
             Scalar tvdCenter = Details::calculateTrueVerticalDepth(
                 cellCenterDepth_[cell], x, y, dipAngle, dipAzimuth, referencePoint);
             const auto pos = CellPos{cell, tvdCenter};
-            saturations = psat.deriveSaturations(pos, eqreg, ptable);
-            pressures = psat.correctedPhasePressures();
+            saturations = cellPsat.deriveSaturations(pos, eqreg, ptable);
+            pressures = cellPsat.correctedPhasePressures();
         }
 
         // Compute solution ratios at cell center TVD
@@ -2370,23 +2603,17 @@ equilibrateTiltedFaultBlockSimple(const CellRange& cells,
 template<class FluidSystem, class Grid, class GridView, class ElementMapper, class CartesianIndexMapper>
 template<class CellRange, class PressTable, class PhaseSat>
 void InitialStateComputer<FluidSystem, Grid, GridView, ElementMapper, CartesianIndexMapper>::
-equilibrateTiltedFaultBlock(const CellRange&        cells,
-                             const EquilReg<Scalar>& eqreg,
-                             const GridView&         gridView,
-                             const int               acc,
-                             const PressTable&       ptable,
-                             PhaseSat&               psat)
+equilibrateTiltedFaultBlock(const CellRange&            cells,
+                             const EquilReg<Scalar>&     eqreg,
+                             const std::vector<Element>& entityMap,
+                             const int                   acc,
+                             const PressTable&           ptable,
+                             PhaseSat&                   psat)
 {
     using CellPos = typename PhaseSat::Position;
     using CellID  = std::remove_cv_t<std::remove_reference_t<
         decltype(std::declval<CellPos>().cell)>>;
 
-    std::vector<typename GridView::template Codim<0>::Entity> entityMap(gridView.size(0));
-    for (const auto& entity : entities(gridView, Dune::Codim<0>())) {
-        CellID idx = gridView.indexSet().index(entity);
-        entityMap[idx] = entity;
-    }
-
     // Face Area Calculation
     auto polygonArea = [](const std::vector<std::array<Scalar, 2>>& pts) {
         if (pts.size() < 3) return Scalar(0);
@@ -2470,8 +2697,9 @@ equilibrateTiltedFaultBlock(const CellRange&        cells,
         }
     };
 
-    auto cellProcessor = [this, acc, &eqreg, &ptable, &psat, &computeCrossSectionArea]
+    auto cellProcessor = [this, acc, &eqreg, &ptable, &computeCrossSectionArea]
         (const CellID                 cell,
+         PhaseSat&                    cellPsat,
          Details::PhaseQuantityValue<Scalar>& pressures,
          Details::PhaseQuantityValue<Scalar>& saturations,
          Scalar&                      Rs,
@@ -2558,8 +2786,8 @@ equilibrateTiltedFaultBlock(const CellRange&        cells,
 
             const auto pos = CellPos{cell, tvd};
 
-            auto localSaturations = psat.deriveSaturations(pos, eqreg, ptable);
-            auto localPressures = psat.correctedPhasePressures();
+            auto localSaturations = cellPsat.deriveSaturations(pos, eqreg, ptable);
+            auto localPressures = cellPsat.correctedPhasePressures();
 
             // Apply cross-section weighted averaging
             saturations.axpy(localSaturations, weight);
@@ -2576,8 +2804,8 @@ equilibrateTiltedFaultBlock(const CellRange&        cells,
             Scalar tvdCenter = Details::calculateTrueVerticalDepth(
                 this->cellCenterDepth_[cell], xy.first, xy.second, dipAngle, dipAzimuth, referencePoint);
             const auto pos = CellPos{cell, tvdCenter};
-            saturations = psat.deriveSaturations(pos, eqreg, ptable);
-            pressures = psat.correctedPhasePressures();
+            saturations = cellPsat.deriveSaturations(pos, eqreg, ptable);
+            pressures = cellPsat.correctedPhasePressures();
         }
 
         // Compute solution ratios at cell center TVD
@@ -2591,7 +2819,7 @@ equilibrateTiltedFaultBlock(const CellRange&        cells,
         Rvw = eqreg.waterEvaporationCalculator()(tvdCenter, pressures.gas, temp, saturations.water);
     };
 
-    this->cellLoop(cells, cellProcessor);
+    this->cellLoop(cells, psat, cellProcessor);
 }
 }
 } // namespace EQUIL
@@ -0,0 +1,202 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+
+#include <config.h>
+
+#include <opm/simulators/flow/equil/PressureTableCache.hpp>
+
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
+
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/InitConfig/Equil.hpp>
+
+#include <fmt/format.h>
+
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <system_error>
+
+namespace {
+
+/// Version of the cached table format.  Part of every key, so bumping it
+/// invalidates all existing cache entries.
+constexpr std::uint64_t formatVersion = 1;
+
+/// 64-bit FNV-1a hash.
+class Hasher
+{
+public:
+    void add(const char* data, const std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; ++i) {
+            this->hash_ ^= static_cast<unsigned char>(data[i]);
+            this->hash_ *= 0x100000001b3ULL;
+        }
+    }
+
+    template <typename T>
+    void add(const T& value)
+    {
+        this->add(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    std::uint64_t value() const
+    {
+        return this->hash_;
+    }
+
+private:
+    std::uint64_t hash_{0xcbf29ce484222325ULL};
+};
+
+/// Serializer giving access to the packed byte representation of
+/// objects, for hashing.
+class HashSerializer : public Opm::Serializer<Opm::Serialization::MemPacker>
+{
+public:
+    HashSerializer()
+        : Opm::Serializer<Opm::Serialization::MemPacker>(packer_)
+    {}
+
+    template <class... Args>
+    void hash(Hasher& hasher, const Args&... args)
+    {
+        this->pack(args...);
+        hasher.add(this->m_buffer.data(), this->m_packSize);
+    }
+
+private:
+    Opm::Serialization::MemPacker packer_{};
+};
+
+} // Anonymous namespace
+
+namespace Opm {
+namespace EQUIL {
+namespace Details {
+
+PressureTableCache::PressureTableCache(const std::string& directory)
+    : directory_(directory)
+{}
+
+void PressureTableCache::setFluidModel(const EclipseState& eclState)
+{
+    if (!this->enabled()) {
+        return;
+    }
+
+    auto hasher = Hasher{};
+    hasher.add(formatVersion);
+
+    HashSerializer{}.hash(hasher,
+                          eclState.runspec(),
+                          eclState.getSimulationConfig(),
+                          eclState.getTableManager());
+
+    this->fluidKey_ = hasher.value();
+}
+
+std::uint64_t
+PressureTableCache::regionKey(const std::size_t            region,
+                              const EquilRecord&           rec,
+                              const int                    pvtIdx,
+                              const double                 gravity,
+                              const int                    numSamples,
+                              const std::array<double, 2>& span,
+                              const std::size_t            scalarSize) const
+{
+    auto hasher = Hasher{};
+    hasher.add(this->fluidKey_);
+    hasher.add(region);
+    hasher.add(pvtIdx);
+    hasher.add(gravity);
+    hasher.add(numSamples);
+    hasher.add(span);
+    hasher.add(scalarSize);
+
+    HashSerializer{}.hash(hasher, rec);
+
+    return hasher.value();
+}
+
+std::optional<std::string>
+PressureTableCache::load(const std::uint64_t key) const
+{
+    auto is = std::ifstream { this->fileName(key), std::ios::binary };
+    if (!is) {
+        return std::nullopt;
+    }
+
+    auto data = std::string { std::istreambuf_iterator<char>{is},
+                              std::istreambuf_iterator<char>{} };
+    if (is.bad()) {
+        return std::nullopt;
+    }
+
+    return data;
+}
+
+bool PressureTableCache::store(const std::uint64_t key,
+                               const std::string&  data) const
+{
+    auto ec = std::error_code{};
+    std::filesystem::create_directories(this->directory_, ec);
+    if (ec) {
+        return false;
+    }
+
+    // Write to a uniquely named file and rename it, so that readers never
+    // see partial tables, even if several runs store the same table.
+    const auto target = this->fileName(key);
+    auto tmp = target;
+    tmp += fmt::format(".{:016x}.tmp", std::random_device{}());
+
+    {
+        auto os = std::ofstream { tmp, std::ios::binary };
+        os.write(data.data(), static_cast<std::streamsize>(data.size()));
+        if (!os) {
+            std::filesystem::remove(tmp, ec);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tmp, target, ec);
+    if (ec) {
+        std::filesystem::remove(tmp, ec);
+        return false;
+    }
+
+    return true;
+}
+
+std::filesystem::path
+PressureTableCache::fileName(const std::uint64_t key) const
+{
+    return this->directory_ / fmt::format("equil-ptable-{:016x}.bin", key);
+}
+
+} // namespace Details
+} // namespace EQUIL
+} // namespace Opm
@@ -0,0 +1,130 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/**
+ * \file
+ *
+ * \brief On-disk cache of equilibrated phase pressure tables.
+ */
+#ifndef OPM_EQUIL_PRESSURE_TABLE_CACHE_HPP
+#define OPM_EQUIL_PRESSURE_TABLE_CACHE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+namespace Opm {
+
+class EclipseState;
+class EquilRecord;
+
+namespace EQUIL {
+namespace Details {
+
+/// Content-addressed store of equilibrated phase pressure tables.
+///
+/// A phase pressure table is fully determined by the fluid model, the
+/// EQUIL record and the vertical span of its region, the gravity and
+/// the number of sample points.  The cache key is a hash of all of
+/// these, where the fluid model is represented by the serialized run
+/// specification, simulation configuration and table manager of the
+/// input deck.  Runs that differ only in, e.g., grid properties then
+/// share their tables.
+///
+/// Each table is stored in a separate file named by its key, which is
+/// written to a temporary file first and then renamed.  Concurrent runs
+/// may therefore share a cache directory.
+class PressureTableCache
+{
+public:
+    /// Constructor.
+    ///
+    /// \param[in] directory Cache directory.  Caching is disabled if
+    ///    empty.  The directory is created on the first store.
+    explicit PressureTableCache(const std::string& directory = {});
+
+    /// Whether or not caching is enabled.
+    bool enabled() const
+    {
+        return !this->directory_.empty();
+    }
+
+    /// Hash the parts of the input deck which define the fluid model.
+    ///
+    /// Must be called before regionKey() if caching is enabled.
+    ///
+    /// \param[in] eclState Run's static parameters.
+    void setFluidModel(const EclipseState& eclState);
+
+    /// Compute cache key of the pressure table of a single region.
+    ///
+    /// \param[in] region Zero-based EQUIL region index.
+    /// \param[in] rec Equilibration record of \p region.
+    /// \param[in] pvtIdx PVT region index of \p region.
+    /// \param[in] gravity Gravity acceleration.
+    /// \param[in] numSamples Number of sample points of the tables.
+    /// \param[in] span Vertical span of the tables.
+    /// \param[in] scalarSize Size of the floating point type, in bytes.
+    ///
+    /// \return Key identifying the pressure table.
+    std::uint64_t regionKey(std::size_t                  region,
+                            const EquilRecord&           rec,
+                            int                          pvtIdx,
+                            double                       gravity,
+                            int                          numSamples,
+                            const std::array<double, 2>& span,
+                            std::size_t                  scalarSize) const;
+
+    /// Retrieve a stored table.
+    ///
+    /// \param[in] key Cache key from regionKey().
+    ///
+    /// \return Binary table data, or nullopt if not in the cache.
+    std::optional<std::string> load(std::uint64_t key) const;
+
+    /// Store a table.
+    ///
+    /// \param[in] key Cache key from regionKey().
+    /// \param[in] data Binary table data.
+    ///
+    /// \return Whether or not the table was successfully stored.
+    bool store(std::uint64_t key, const std::string& data) const;
+
+private:
+    /// Cache directory.  Empty if caching is disabled.
+    std::filesystem::path directory_{};
+
+    /// Hash of the fluid model.
+    std::uint64_t fluidKey_{0};
+
+    /// File name of the table with a particular key.
+    std::filesystem::path fileName(std::uint64_t key) const;
+};
+
+} // namespace Details
+} // namespace EQUIL
+} // namespace Opm
+
+#endif // OPM_EQUIL_PRESSURE_TABLE_CACHE_HPP
@@ -0,0 +1,90 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_ADAPTIVESETUPREUSE_HEADER_INCLUDED
+#define OPM_ADAPTIVESETUPREUSE_HEADER_INCLUDED
+
+namespace Opm
+{
+
+/// Decide online whether to fully recreate a preconditioner or only
+/// update it, from measured costs.
+///
+/// Reusing a preconditioner set up for an older matrix saves the setup
+/// time, but typically makes the linear solves take more iterations. The
+/// number of iterations of the first solve after a setup is taken as the
+/// baseline, and the time spent on iterations beyond the baseline is
+/// accumulated for later solves. A new setup is requested once this extra
+/// time exceeds what a setup costs on top of the update it replaces. This
+/// is the classic rent-or-buy strategy, which never spends more than twice
+/// the time of the best policy in hindsight.
+class AdaptiveSetupReuse
+{
+public:
+    /// Record a full setup of the preconditioner.
+    /// \param seconds Wall time spent on the setup.
+    void recordSetup(const double seconds)
+    {
+        setup_time_ = seconds;
+        extra_time_ = 0.0;
+        base_iterations_ = -1;
+    }
+
+    /// Record an update of the preconditioner.
+    /// \param seconds Wall time spent on the update.
+    void recordUpdate(const double seconds)
+    {
+        update_time_ = seconds;
+    }
+
+    /// Record a linear solve.
+    /// \param iterations Number of linear iterations.
+    /// \param seconds Wall time spent in the solver.
+    void recordSolve(const int iterations, const double seconds)
+    {
+        if (base_iterations_ < 0) {
+            base_iterations_ = iterations;
+            return;
+        }
+        if (iterations > base_iterations_) {
+            extra_time_ += (iterations - base_iterations_) * seconds / iterations;
+        }
+    }
+
+    /// Return true if the preconditioner should be recreated before the
+    /// next solve, instead of only updated.
+    bool shouldRecreate() const
+    {
+        return extra_time_ >= setup_time_ - update_time_;
+    }
+
+    /// Time spent on iterations beyond the baseline since the last setup.
+    double extraTime() const
+    {
+        return extra_time_;
+    }
+
+private:
+    double setup_time_ = 0.0;
+    double update_time_ = 0.0;
+    double extra_time_ = 0.0;
+    int base_iterations_ = -1;
+};
+
+} // namespace Opm
+
+#endif // OPM_ADAPTIVESETUPREUSE_HEADER_INCLUDED
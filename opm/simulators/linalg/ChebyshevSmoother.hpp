@@ -0,0 +1,270 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_CHEBYSHEVSMOOTHER_HEADER_INCLUDED
+#define OPM_CHEBYSHEVSMOOTHER_HEADER_INCLUDED
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/common/TimingMacros.hpp>
+#include <opm/simulators/linalg/PreconditionerWithUpdate.hpp>
+
+#include <dune/common/unused.hh>
+#include <dune/istl/bcrsmatrix.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace Dune
+{
+
+/*! \brief Chebyshev polynomial smoother with block Jacobi scaling.
+ *  \details Applies a Chebyshev polynomial in D^-1 A, where D is the block
+             diagonal of A, targeting the eigenvalues in
+             [lambda_max / eigenvalueRatio, lambda_max]. This damps the
+             upper part of the spectrum as needed for an AMG smoother.
+             The largest eigenvalue of D^-1 A is estimated by power
+             iteration in update().
+
+             The smoother consists only of matrix-vector products and vector
+             updates, which are thread parallelized with OpenMP. Used inside
+             a BlockPreconditioner it needs no communication beyond the
+             overlap update of the AMG cycle.
+
+   \tparam M The matrix type to operate on
+   \tparam X Type of the update
+   \tparam Y Type of the defect
+*/
+template <class M, class X, class Y>
+class ChebyshevSmoother : public PreconditionerWithUpdate<X, Y>
+{
+public:
+    //! \brief The matrix type the preconditioner is for.
+    using matrix_type = M;
+    //! \brief The domain type of the preconditioner.
+    using domain_type = X;
+    //! \brief The range type of the preconditioner.
+    using range_type = Y;
+    //! \brief The field type of the preconditioner.
+    using field_type = typename X::field_type;
+
+    /*! \brief Constructor gets all parameters to operate the prec.
+       \param A The matrix to operate on.
+       \param degree Degree of the polynomial, i.e. the number of
+                     matrix-vector products per application.
+       \param eigenvalueRatio Ratio between the largest and the smallest
+                              eigenvalue targeted by the polynomial.
+       \param powerIterations Number of power iterations used to estimate
+                              the largest eigenvalue.
+    */
+    ChebyshevSmoother(const M& A,
+                      int degree,
+                      double eigenvalueRatio = 30.0,
+                      int powerIterations = 10)
+        : A_(A)
+        , degree_(degree)
+        , eigenvalue_ratio_(eigenvalueRatio)
+        , power_iterations_(powerIterations)
+    {
+        OPM_TIMEBLOCK(prec_construct);
+        if (degree_ < 1) {
+            OPM_THROW(std::invalid_argument, "Chebyshev smoother degree must be positive");
+        }
+        if (eigenvalue_ratio_ <= 1.0) {
+            OPM_THROW(std::invalid_argument, "Chebyshev smoother eigenvalue ratio must be larger than one");
+        }
+        Dinv_.resize(A_.N());
+        r_.resize(A_.N());
+        z_.resize(A_.N());
+        p_.resize(A_.N());
+        update();
+    }
+
+    /*!
+       \brief Update the preconditioner.
+       \copydoc Preconditioner::update()
+    */
+    void update() override
+    {
+        OPM_TIMEBLOCK(prec_update);
+        const int n = A_.N();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int row = 0; row < n; ++row) {
+            Dinv_[row] = A_[row][row];
+            Dinv_[row].invert();
+        }
+
+        lambda_max_ = 1.1 * estimateLargestEigenvalue();
+        lambda_min_ = lambda_max_ / eigenvalue_ratio_;
+    }
+
+    /*!
+       \brief Prepare the preconditioner.
+       \copydoc Preconditioner::pre(X&,Y&)
+    */
+    void pre(X& v, Y& d) override
+    {
+        DUNE_UNUSED_PARAMETER(v);
+        DUNE_UNUSED_PARAMETER(d);
+    }
+
+    /*!
+       \brief Apply the preconditioner.
+       \copydoc Preconditioner::apply(X&,const Y&)
+    */
+    void apply(X& v, const Y& d) override
+    {
+        OPM_TIMEBLOCK(prec_apply);
+        const int n = A_.N();
+        const field_type theta = (lambda_max_ + lambda_min_) / 2;
+        const field_type delta = (lambda_max_ - lambda_min_) / 2;
+
+        // r = d - A v, p = D^-1 r / theta, v += p
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int row = 0; row < n; ++row) {
+            r_[row] = d[row];
+            for (auto col = A_[row].begin(); col != A_[row].end(); ++col) {
+                col->mmv(v[col.index()], r_[row]);
+            }
+            Dinv_[row].mv(r_[row], p_[row]);
+            p_[row] /= theta;
+        }
+        v += p_;
+
+        field_type rho_old = delta / theta;
+        for (int k = 1; k < degree_; ++k) {
+            const field_type rho = 1 / (2 * theta / delta - rho_old);
+            const field_type alpha = rho * rho_old;
+            const field_type beta = 2 * rho / delta;
+            // r -= A p, p = alpha p + beta D^-1 r
+            // All residual updates must see the previous p, so this
+            // needs two passes.
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for (int row = 0; row < n; ++row) {
+                for (auto col = A_[row].begin(); col != A_[row].end(); ++col) {
+                    col->mmv(p_[col.index()], r_[row]);
+                }
+                Dinv_[row].mv(r_[row], z_[row]);
+            }
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for (int row = 0; row < n; ++row) {
+                p_[row] *= alpha;
+                p_[row].axpy(beta, z_[row]);
+                v[row] += p_[row];
+            }
+            rho_old = rho;
+        }
+    }
+
+    /*!
+       \brief Clean up.
+       \copydoc Preconditioner::post(X&)
+    */
+    void post(X& x) override
+    {
+        DUNE_UNUSED_PARAMETER(x);
+    }
+
+    //! Category of the preconditioner (see SolverCategory::Category)
+    SolverCategory::Category category() const override
+    {
+        return SolverCategory::sequential;
+    }
+
+    bool hasPerfectUpdate() const override
+    {
+        return true;
+    }
+
+    //! \brief The estimated largest eigenvalue of D^-1 A, including the safety factor.
+    field_type largestEigenvalue() const
+    {
+        return lambda_max_;
+    }
+
+private:
+    //! \brief Estimate the largest eigenvalue of D^-1 A by power iteration.
+    field_type estimateLargestEigenvalue()
+    {
+        const int n = A_.N();
+        if (n == 0) {
+            return 1;
+        }
+
+        // Deterministic start vector, not orthogonal to the smooth modes.
+        for (int row = 0; row < n; ++row) {
+            for (std::size_t i = 0; i < z_[row].size(); ++i) {
+                z_[row][i] = 1 + ((row + i) % 7) / field_type(10);
+            }
+        }
+        z_ /= z_.two_norm();
+
+        field_type lambda = 1;
+        for (int it = 0; it < power_iterations_; ++it) {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for (int row = 0; row < n; ++row) {
+                typename X::block_type Az(0);
+                for (auto col = A_[row].begin(); col != A_[row].end(); ++col) {
+                    col->umv(z_[col.index()], Az);
+                }
+                Dinv_[row].mv(Az, p_[row]);
+            }
+            const field_type norm = p_.two_norm();
+            if (!(norm > 0) || !std::isfinite(norm)) {
+                break;
+            }
+            lambda = norm;
+            z_ = p_;
+            z_ /= norm;
+        }
+        return lambda;
+    }
+
+    //! \brief The matrix we operate on.
+    const M& A_;
+    //! \brief Degree of the polynomial.
+    int degree_;
+    //! \brief Ratio between the largest and smallest targeted eigenvalue.
+    double eigenvalue_ratio_;
+    //! \brief Number of power iterations in the eigenvalue estimate.
+    int power_iterations_;
+    //! \brief The inverse of the diagonal blocks of A.
+    std::vector<typename M::block_type> Dinv_;
+    //! \brief Bounds of the targeted eigenvalue interval.
+    field_type lambda_min_ = 0;
+    field_type lambda_max_ = 1;
+    //! \brief Work vectors for the residual, scaled residual and update.
+    X r_;
+    X z_;
+    X p_;
+};
+
+} // namespace Dune
+
+#endif // OPM_CHEBYSHEVSMOOTHER_HEADER_INCLUDED
@@ -1,6 +1,7 @@
 #ifndef OPM_EXTRASMOOTHERS_HPP
 #define OPM_EXTRASMOOTHERS_HPP
 
+#include "ChebyshevSmoother.hpp"
 #include "DILU.hpp"
 
 namespace Dune
@@ -8,6 +9,9 @@ namespace Dune
     template <class M, class X, class Y>
     class MultithreadDILU;
 
+    template <class M, class X, class Y>
+    class ChebyshevSmoother;
+
 namespace Amg
 {
     /**
@@ -22,6 +26,20 @@ namespace Amg
         }
     };
 
+    /**
+     * @brief Policy for the construction of the ChebyshevSmoother
+     *
+     * The number of smoother iterations is used as the polynomial degree.
+     */
+    template <class M, class X, class Y>
+    struct ConstructionTraits<ChebyshevSmoother<M, X, Y>> {
+    using Arguments = DefaultConstructionArgs<ChebyshevSmoother<M, X, Y>>;
+
+        static inline std::shared_ptr<ChebyshevSmoother<M, X, Y>> construct(Arguments& args) {
+            return std::make_shared<ChebyshevSmoother<M, X, Y>>(args.getMatrix(), args.getArgs().iterations);
+        }
+    };
+
 } // namespace Amg
 } // namespace Dune
 #endif // OPM_EXTRASMOOTHERS_HPP
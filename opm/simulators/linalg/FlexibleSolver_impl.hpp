@@ -28,7 +28,9 @@
 #include <opm/simulators/linalg/FlexibleSolver.hpp>
 #include <opm/simulators/linalg/PreconditionerFactory.hpp>
 #include <opm/simulators/linalg/PropertyTree.hpp>
+#include <opm/simulators/linalg/PipelinedBiCGSTABSolver.hpp>
 #include <opm/simulators/linalg/Preconditioner2InverseOperator.hpp>
+#include <opm/simulators/linalg/RecyclingGCRSolver.hpp>
 #include <opm/simulators/linalg/WellOperators.hpp>
 #include <opm/simulators/linalg/PreconditionerFactoryGPUIncludeWrapper.hpp>
 #include <opm/simulators/linalg/is_gpu_operator.hpp>
@@ -255,6 +257,21 @@ namespace Dune
                                                                             comm);
             }
 #endif
+        } else if (solver_type == "pbicgstab") {
+            if constexpr (Opm::is_gpu_operator_v<Operator>) {
+                OPM_THROW(std::invalid_argument, "pbicgstab solver not supported for GPU operators.");
+            } else if constexpr (Opm::detail::is_multi_type_block_vector_v<VectorType>) {
+                OPM_THROW(std::invalid_argument, "pbicgstab solver not supported for multi-type block vectors.");
+            } else {
+                int restart = prm.get<int>("restart", 50);
+                linsolver_ = std::make_shared<Dune::PipelinedBiCGSTABSolver<VectorType, Comm>>(*linearoperator_for_solver_,
+                                                                                              *preconditioner_,
+                                                                                              tol, // desired residual reduction factor
+                                                                                              restart, // iterations between residual replacements
+                                                                                              maxiter, // maximum number of iterations
+                                                                                              verbosity,
+                                                                                              comm);
+            }
         } else if (solver_type == "cg") {
             linsolver_ = std::make_shared<Dune::CGSolver<VectorType>>(*linearoperator_for_solver_,
                                                                       *scalarproduct_,
@@ -291,6 +308,23 @@ namespace Dune
                                                                                         maxiter, // maximum number of iterations
                                                                                         verbosity);
             }
+        } else if (solver_type == "recyclinggcr") {
+            if constexpr (Opm::is_gpu_operator_v<Operator>) {
+                OPM_THROW(std::invalid_argument, "recyclinggcr solver not supported for GPU operators.");
+            } else if constexpr (Opm::detail::is_multi_type_block_vector_v<VectorType>) {
+                OPM_THROW(std::invalid_argument, "recyclinggcr solver not supported for multi-type block vectors.");
+            } else {
+                int restart = prm.get<int>("restart", 15);
+                int recycle = prm.get<int>("recycle", 5);
+                linsolver_ = std::make_shared<Dune::RecyclingGCRSolver<VectorType>>(*linearoperator_for_solver_,
+                                                                                   *scalarproduct_,
+                                                                                   *preconditioner_,
+                                                                                   tol, // desired residual reduction factor
+                                                                                   restart,
+                                                                                   recycle, // vectors kept between solves
+                                                                                   maxiter, // maximum number of iterations
+                                                                                   verbosity);
+            }
         } else if (solver_type == "preconditioner2inverseoperator") {
             if (!preconditioner_) {
                 OPM_THROW(std::invalid_argument,
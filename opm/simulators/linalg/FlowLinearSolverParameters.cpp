@@ -152,7 +152,9 @@ void FlowLinearSolverParameters::registerParameters()
          "1: recreate once every timestep, "
          "2: recreate if last linear solve took more than 10 iterations, "
          "3: never recreate, "
-         "4: recreated every CprReuseInterval");
+         "4: recreated every CprReuseInterval, "
+         "5: recreated when the extra linear iterations since the last "
+         "setup have cost more time than a new setup");
     Parameters::Register<Parameters::CprReuseInterval>
         ("Reuse preconditioner interval. Used when CprReuseSetup is set to 4, "
          "then the preconditioner will be fully recreated instead of reused "
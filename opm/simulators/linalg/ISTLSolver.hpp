@@ -22,6 +22,7 @@
 #ifndef OPM_ISTLSOLVER_HEADER_INCLUDED
 #define OPM_ISTLSOLVER_HEADER_INCLUDED
 
+#include <dune/common/timer.hh>
 #include <dune/istl/owneroverlapcopy.hh>
 #include <dune/istl/solver.hh>
 
@@ -39,6 +40,7 @@
 #include <opm/simulators/flow/BlackoilModelParameters.hpp>
 #include <opm/simulators/flow/FlowBaseVanguard.hpp>
 #include <opm/simulators/flow/FlowBaseProblemProperties.hpp>
+#include <opm/simulators/linalg/AdaptiveSetupReuse.hpp>
 #include <opm/simulators/linalg/ExtractParallelGridInformationToISTL.hpp>
 #include <opm/simulators/linalg/FlowLinearSolverParameters.hpp>
 #include <opm/simulators/linalg/matrixblock.hh>
@@ -118,6 +120,7 @@ struct FlexibleSolverInfo
     std::unique_ptr<LinearOperatorExtra<Vector,Vector>> wellOperator_;
     AbstractPreconditionerType* pre_ = nullptr;
     std::size_t interiorCellNum_ = 0;
+    AdaptiveSetupReuse setupReuse_;
 };
 
 
@@ -448,6 +451,7 @@ std::unique_ptr<Matrix> blockJacobiAdjacency(const Grid& grid,
             }
 
             iterations_ = result.iterations;
+            flexibleSolver_[activeSolverNum_].setupReuse_.recordSolve(result.iterations, result.elapsed);
 
             // Check convergence, iterations etc.
             return checkConvergence(result);
@@ -513,6 +517,7 @@ std::unique_ptr<Matrix> blockJacobiAdjacency(const Grid& grid,
                 }
                 std::function<Vector()> weightCalculator = this->getWeightsCalculator(prm_[activeSolverNum_], getMatrix(), pressureIndex);
                 OPM_TIMEBLOCK(flexibleSolverCreate);
+                Dune::Timer timer;
                 flexibleSolver_[activeSolverNum_].create(getMatrix(),
                                                          isParallel(),
                                                          prm_[activeSolverNum_],
@@ -520,12 +525,15 @@ std::unique_ptr<Matrix> blockJacobiAdjacency(const Grid& grid,
                                                          weightCalculator,
                                                          forceSerial_,
                                                          comm_.get());
+                flexibleSolver_[activeSolverNum_].setupReuse_.recordSetup(timer.elapsed());
                 numWellEquations_ = this->numWellEquations();
             }
             else
             {
                 OPM_TIMEBLOCK(flexibleSolverUpdate);
+                Dune::Timer timer;
                 flexibleSolver_[activeSolverNum_].pre_->update();
+                flexibleSolver_[activeSolverNum_].setupReuse_.recordUpdate(timer.elapsed());
             }
         }
 
@@ -541,6 +549,19 @@ std::unique_ptr<Matrix> blockJacobiAdjacency(const Grid& grid,
         /// Return true if we should (re)create the whole solver,
         /// instead of just calling update() on the preconditioner.
         bool shouldCreateSolver() const
+        {
+            const bool create = this->shouldCreateSolverLocal();
+            // Creating the solver is collective, but the local decision may
+            // differ between processes, e.g., when a well is opened on some
+            // of them only, or from the timings of the adaptive reuse mode.
+            if (isParallel()) {
+                return comm_->communicator().max(static_cast<int>(create)) != 0;
+            }
+            return create;
+        }
+
+        /// Return true if this process should (re)create the whole solver.
+        bool shouldCreateSolverLocal() const
         {
             // Decide if we should recreate the solver or just do
             // a minimal preconditioner update.
@@ -593,6 +614,11 @@ std::unique_ptr<Matrix> blockJacobiAdjacency(const Grid& grid,
                 const bool create = ((solveCount_ % step) == 0);
                 return create;
             }
+            if (this->parameters_[activeSolverNum_].cpr_reuse_setup_ == 5) {
+                // Recreate solver when the extra iterations since the last
+                // setup have cost more than a new setup.
+                return flexibleSolver_[activeSolverNum_].setupReuse_.shouldRecreate();
+            }
             // If here, we have an invalid parameter.
             const bool on_io_rank = (simulator_.gridView().comm().rank() == 0);
             std::string msg = "Invalid value: " + std::to_string(this->parameters_[activeSolverNum_].cpr_reuse_setup_)
@@ -621,7 +647,8 @@ std::unique_ptr<Matrix> blockJacobiAdjacency(const Grid& grid,
             // We use lower case as the internal canonical representation of solver names
             std::ranges::transform(preconditionerType, preconditionerType.begin(), ::tolower);
             if (preconditionerType == "cpr" || preconditionerType == "cprt"
-                || preconditionerType == "cprw" || preconditionerType == "cprwt") {
+                || preconditionerType == "cprw" || preconditionerType == "cprwt"
+                || preconditionerType == "cprfloat") {
                 const bool transpose = preconditionerType == "cprt" || preconditionerType == "cprwt";
                 const bool enableThreadParallel = this->parameters_[0].cpr_weights_thread_parallel_;
                 const auto weightsType = prm.get("preconditioner.weight_type"s, "quasiimpes"s);
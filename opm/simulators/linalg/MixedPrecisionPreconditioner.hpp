@@ -0,0 +1,209 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_MIXEDPRECISIONPRECONDITIONER_HEADER_INCLUDED
+#define OPM_MIXEDPRECISIONPRECONDITIONER_HEADER_INCLUDED
+
+#include <opm/common/TimingMacros.hpp>
+
+#include <opm/simulators/linalg/PreconditionerFactory.hpp>
+#include <opm/simulators/linalg/PreconditionerWithUpdate.hpp>
+#include <opm/simulators/linalg/PropertyTree.hpp>
+#include <opm/simulators/linalg/matrixblock.hh>
+
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+#include <dune/istl/operators.hh>
+#include <dune/istl/paamg/pinfo.hh>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace Opm
+{
+
+/// \brief Run a preconditioner in single precision inside a double precision solver.
+///
+/// A float copy of the system matrix is kept, and the preconditioner given
+/// by the property tree is created for it through the PreconditionerFactory.
+/// This way, a whole CPR preconditioner, with the coarse pressure system,
+/// its AMG hierarchy and the fine smoother, is stored and applied in float.
+/// The Krylov solver using this preconditioner still works in double.
+///
+/// The float preconditioner only sees the matrix, so well contributions
+/// that are only part of the linear operator are not included. Its pre()
+/// and post() steps are called on float copies of the vectors, and the
+/// changes they make are added to the double vectors.
+///
+/// The float matrix has the same sparsity pattern as the original matrix,
+/// so update() only needs to convert the values.
+template <class M, class X, class Y = X>
+class MixedPrecisionPreconditioner : public Dune::PreconditionerWithUpdate<X, Y>
+{
+public:
+    using Block = typename M::block_type;
+    using FloatMatrix = Dune::BCRSMatrix<MatrixBlock<float, Block::rows, Block::cols>>;
+    using FloatVector = Dune::BlockVector<Dune::FieldVector<float, X::block_type::dimension>>;
+    using FloatOperator = Dune::MatrixAdapter<FloatMatrix, FloatVector, FloatVector>;
+    using FloatFactory = PreconditionerFactory<FloatOperator, Dune::Amg::SequentialInformation>;
+
+    /// \param matrix System matrix, must be kept alive by the caller.
+    /// \param prm Configuration of the preconditioner to run in float.
+    /// \param weightsCalculator Weights for CPR, converted to float.
+    /// \param pressureIndex Index of the pressure variable for CPR.
+    MixedPrecisionPreconditioner(const M& matrix,
+                                 const PropertyTree& prm,
+                                 const std::function<X()>& weightsCalculator,
+                                 std::size_t pressureIndex)
+        : matrix_(matrix)
+        , float_matrix_(createFloatMatrix(matrix))
+        , float_operator_(float_matrix_)
+    {
+        std::function<FloatVector()> floatWeightsCalculator;
+        if (weightsCalculator) {
+            floatWeightsCalculator = [weightsCalculator]()
+            {
+                FloatVector weights;
+                convert(weightsCalculator(), weights);
+                return weights;
+            };
+        }
+        float_prec_ = FloatFactory::create(float_operator_, prm, floatWeightsCalculator, pressureIndex);
+    }
+
+    void pre(X& x, Y& b) override
+    {
+        convert(x, float_v_);
+        convert(b, float_d_);
+        float_prec_->pre(float_v_, float_d_);
+        addChanges(float_v_, x);
+        addChanges(float_d_, b);
+    }
+
+    void apply(X& v, const Y& d) override
+    {
+        OPM_TIMEBLOCK(apply);
+        convert(d, float_d_);
+        float_v_.resize(v.size());
+        float_v_ = 0.0f;
+        float_prec_->apply(float_v_, float_d_);
+        for (std::size_t i = 0; i < v.size(); ++i) {
+            for (std::size_t j = 0; j < v[i].size(); ++j) {
+                v[i][j] = float_v_[i][j];
+            }
+        }
+    }
+
+    void post(X& x) override
+    {
+        convert(x, float_v_);
+        float_prec_->post(float_v_);
+        addChanges(float_v_, x);
+    }
+
+    void update() override
+    {
+        OPM_TIMEBLOCK(update);
+        updateFloatMatrix();
+        float_prec_->update();
+    }
+
+    Dune::SolverCategory::Category category() const override
+    {
+        return Dune::SolverCategory::sequential;
+    }
+
+    bool hasPerfectUpdate() const override
+    {
+        return float_prec_->hasPerfectUpdate();
+    }
+
+private:
+    template <class Vector>
+    static void convert(const Vector& from, FloatVector& to)
+    {
+        to.resize(from.size());
+        for (std::size_t i = 0; i < from.size(); ++i) {
+            for (std::size_t j = 0; j < from[i].size(); ++j) {
+                to[i][j] = static_cast<float>(from[i][j]);
+            }
+        }
+    }
+
+    //! Add the changes made to the float copy of a vector to the vector.
+    //! Only the changes are added, so unchanged entries keep their precision.
+    template <class Vector>
+    static void addChanges(const FloatVector& changed, Vector& v)
+    {
+        for (std::size_t i = 0; i < v.size(); ++i) {
+            for (std::size_t j = 0; j < v[i].size(); ++j) {
+                const float original = static_cast<float>(v[i][j]);
+                if (changed[i][j] != original) {
+                    v[i][j] += changed[i][j] - original;
+                }
+            }
+        }
+    }
+
+    static FloatMatrix createFloatMatrix(const M& matrix)
+    {
+        FloatMatrix result(matrix.N(), matrix.M(), matrix.nonzeroes(), FloatMatrix::row_wise);
+        auto rowIn = matrix.begin();
+        for (auto rowOut = result.createbegin(); rowOut != result.createend(); ++rowOut, ++rowIn) {
+            for (auto col = rowIn->begin(); col != rowIn->end(); ++col) {
+                rowOut.insert(col.index());
+            }
+        }
+        copyValues(matrix, result);
+        return result;
+    }
+
+    static void copyValues(const M& from, FloatMatrix& to)
+    {
+        const int num_rows = from.N();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int row = 0; row < num_rows; ++row) {
+            auto colOut = to[row].begin();
+            for (auto colIn = from[row].begin(); colIn != from[row].end(); ++colIn, ++colOut) {
+                for (int i = 0; i < Block::rows; ++i) {
+                    for (int j = 0; j < Block::cols; ++j) {
+                        (*colOut)[i][j] = static_cast<float>((*colIn)[i][j]);
+                    }
+                }
+            }
+        }
+    }
+
+    void updateFloatMatrix()
+    {
+        copyValues(matrix_, float_matrix_);
+    }
+
+    const M& matrix_;
+    FloatMatrix float_matrix_;
+    FloatOperator float_operator_;
+    std::shared_ptr<Dune::PreconditionerWithUpdate<FloatVector, FloatVector>> float_prec_;
+    FloatVector float_v_;
+    FloatVector float_d_;
+};
+
+} // namespace Opm
+
+#endif // OPM_MIXEDPRECISIONPRECONDITIONER_HEADER_INCLUDED
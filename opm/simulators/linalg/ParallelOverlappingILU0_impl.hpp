@@ -32,68 +32,114 @@
 #include <opm/simulators/linalg/matrixblock.hh>
 
 #include <cassert>
+#include <exception>
+
+#if HAVE_OPENMP
+#include <omp.h>
+#endif
 
 namespace Opm
 {
 namespace detail
 {
 
+//! Compute row i of the blocked ILU0 decomposition, using the rows above it
+template<class M>
+void bilu0_decomposition_row (M& A, typename M::RowIterator i)
+{
+    using coliterator = typename M::ColIterator;
+    using block = typename M::block_type;
+
+    // coliterator is diagonal after the following loop
+    coliterator endij=(*i).end();           // end of row i
+    coliterator ij;
+
+    // eliminate entries left of diagonal; store L factor
+    for (ij=(*i).begin(); ij.index()<i.index(); ++ij)
+    {
+        // find A_jj which eliminates A_ij
+        coliterator jj = A[ij.index()].find(ij.index());
+
+        // compute L_ij = A_jj^-1 * A_ij
+        (*ij).rightmultiply(*jj);
+
+        // modify row
+        coliterator endjk=A[ij.index()].end();    // end of row j
+        coliterator jk=jj; ++jk;
+        coliterator ik=ij; ++ik;
+        while (ik!=endij && jk!=endjk)
+            if (ik.index()==jk.index())
+            {
+                block B(*jk);
+                B.leftmultiply(*ij);
+                *ik -= B;
+                ++ik; ++jk;
+            }
+            else
+            {
+                if (ik.index()<jk.index())
+                    ++ik;
+                else
+                    ++jk;
+            }
+    }
+
+    // invert pivot and store it in A
+    if (ij.index()!=i.index())
+        DUNE_THROW(Dune::ISTLError,"diagonal entry missing");
+    try {
+        (*ij).invert();   // compute inverse of diagonal block
+    }
+    catch (Dune::FMatrixError & e) {
+        DUNE_THROW(Dune::ISTLError,"ILU failed to invert matrix block");
+    }
+}
+
 //! Compute Blocked ILU0 decomposition, when we know junk ghost rows are located at the end of A
 template<class M>
 void ghost_last_bilu0_decomposition (M& A, std::size_t interiorSize)
 {
     OPM_TIMEBLOCK(GhostLastBlockILU0Decomp);
-    // iterator types
     assert(interiorSize <= A.N());
-    using rowiterator = typename M::RowIterator;
-    using coliterator = typename M::ColIterator;
-    using block = typename M::block_type;
 
     // implement left looking variant with stored inverse
-    for (rowiterator i = A.begin(); i.index() < interiorSize; ++i)
+    for (auto i = A.begin(); i.index() < interiorSize; ++i)
     {
-        // coliterator is diagonal after the following loop
-        coliterator endij=(*i).end();           // end of row i
-        coliterator ij;
+        bilu0_decomposition_row(A, i);
+    }
+}
 
-        // eliminate entries left of diagonal; store L factor
-        for (ij=(*i).begin(); ij.index()<i.index(); ++ij)
-        {
-            // find A_jj which eliminates A_ij
-            coliterator jj = A[ij.index()].find(ij.index());
-
-            // compute L_ij = A_jj^-1 * A_ij
-            (*ij).rightmultiply(*jj);
-
-            // modify row
-            coliterator endjk=A[ij.index()].end();    // end of row j
-            coliterator jk=jj; ++jk;
-            coliterator ik=ij; ++ik;
-            while (ik!=endij && jk!=endjk)
-                if (ik.index()==jk.index())
-                {
-                    block B(*jk);
-                    B.leftmultiply(*ij);
-                    *ik -= B;
-                    ++ik; ++jk;
+//! Compute Blocked ILU0 decomposition of the first interiorSize rows using threads.
+//! The rows of each level only depend on rows of lower levels, and are computed in parallel.
+template<class M>
+void level_scheduled_bilu0_decomposition (M& A, std::size_t interiorSize,
+                                          const SparseTable<std::size_t>& levels)
+{
+    OPM_TIMEBLOCK(LevelScheduledBlockILU0Decomp);
+    assert(interiorSize <= A.N());
+
+    std::exception_ptr exc;
+    for (int level = 0; level < levels.size(); ++level) {
+        const auto rows = levels[level].begin();
+        const int num_rows = levels[level].size();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int k = 0; k < num_rows; ++k) {
+            if (rows[k] < interiorSize) {
+                try {
+                    bilu0_decomposition_row(A, A.begin() + rows[k]);
                 }
-                else
-                {
-                    if (ik.index()<jk.index())
-                        ++ik;
-                    else
-                        ++jk;
+                catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(level_scheduled_bilu0)
+#endif
+                    exc = std::current_exception();
                 }
+            }
         }
-
-        // invert pivot and store it in A
-        if (ij.index()!=i.index())
-            DUNE_THROW(Dune::ISTLError,"diagonal entry missing");
-        try {
-            (*ij).invert();   // compute inverse of diagonal block
-        }
-        catch (Dune::FMatrixError & e) {
-            DUNE_THROW(Dune::ISTLError,"ILU failed to invert matrix block");
+        if (exc) {
+            std::rethrow_exception(exc);
         }
     }
 }
@@ -257,6 +303,16 @@ size_t set_interiorSize(size_t N, size_t interiorSize, const Dune::OwnerOverlapC
 }
 #endif
 
+//! Whether threads should be used when multithreading is requested.
+inline bool useThreads([[maybe_unused]] bool multithreaded)
+{
+#if HAVE_OPENMP
+    return multithreaded && omp_get_max_threads() > 1;
+#else
+    return false;
+#endif
+}
+
 } // end namespace detail
 
 
@@ -273,14 +329,15 @@ ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
 ParallelOverlappingILU0(const Matrix& A,
                         const int n, const field_type w,
                         MILU_VARIANT milu, bool redblack,
-                        bool reorder_sphere)
+                        bool reorder_sphere, bool multithreaded)
     : lower_(),
       upper_(),
       inv_(),
       comm_(nullptr), w_(w),
       relaxation_( std::abs( w - 1.0 ) > 1e-15 ),
       A_(&reinterpret_cast<const Matrix&>(A)), iluIteration_(n),
-      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere)
+      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere),
+      multithreaded_(detail::useThreads(multithreaded))
 {
     interiorSize_ = A.N();
     // BlockMatrix is a Subclass of FieldMatrix that just adds
@@ -293,14 +350,15 @@ ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
 ParallelOverlappingILU0(const Matrix& A,
                         const ParallelInfo& comm, const int n, const field_type w,
                         MILU_VARIANT milu, bool redblack,
-                        bool reorder_sphere)
+                        bool reorder_sphere, bool multithreaded)
     : lower_(),
       upper_(),
       inv_(),
       comm_(&comm), w_(w),
       relaxation_( std::abs( w - 1.0 ) > 1e-15 ),
       A_(&reinterpret_cast<const Matrix&>(A)), iluIteration_(n),
-      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere)
+      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere),
+      multithreaded_(detail::useThreads(multithreaded))
 {
     interiorSize_ = A.N();
     // BlockMatrix is a Subclass of FieldMatrix that just adds
@@ -312,8 +370,8 @@ template<class Matrix, class Domain, class Range, class ParallelInfoT>
 ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
 ParallelOverlappingILU0(const Matrix& A,
                         const field_type w, MILU_VARIANT milu, bool redblack,
-                        bool reorder_sphere)
-    : ParallelOverlappingILU0( A, 0, w, milu, redblack, reorder_sphere )
+                        bool reorder_sphere, bool multithreaded)
+    : ParallelOverlappingILU0( A, 0, w, milu, redblack, reorder_sphere, multithreaded )
 {}
 
 template<class Matrix, class Domain, class Range, class ParallelInfoT>
@@ -321,14 +379,15 @@ ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
 ParallelOverlappingILU0(const Matrix& A,
                         const ParallelInfo& comm, const field_type w,
                         MILU_VARIANT milu, bool redblack,
-                        bool reorder_sphere)
+                        bool reorder_sphere, bool multithreaded)
     : lower_(),
       upper_(),
       inv_(),
       comm_(&comm), w_(w),
       relaxation_( std::abs( w - 1.0 ) > 1e-15 ),
       A_(&reinterpret_cast<const Matrix&>(A)), iluIteration_(0),
-      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere)
+      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere),
+      multithreaded_(detail::useThreads(multithreaded))
 {
     interiorSize_ = A.N();
     // BlockMatrix is a Subclass of FieldMatrix that just adds
@@ -342,7 +401,7 @@ ParallelOverlappingILU0(const Matrix& A,
                         const ParallelInfo& comm,
                         const field_type w, MILU_VARIANT milu,
                         size_type interiorSize, bool redblack,
-                        bool reorder_sphere)
+                        bool reorder_sphere, bool multithreaded)
     : lower_(),
       upper_(),
       inv_(),
@@ -350,7 +409,8 @@ ParallelOverlappingILU0(const Matrix& A,
       relaxation_( std::abs( w - 1.0 ) > 1e-15 ),
       interiorSize_(interiorSize),
       A_(&reinterpret_cast<const Matrix&>(A)), iluIteration_(0),
-      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere)
+      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere),
+      multithreaded_(detail::useThreads(multithreaded))
 {
     // BlockMatrix is a Subclass of FieldMatrix that just adds
     // methods. Therefore this cast should be safe.
@@ -379,8 +439,8 @@ apply (Domain& v, const Range& d)
         OPM_THROW(std::logic_error,"ILU: number of lower and upper rows must be the same");
     }
 
-    // lower triangular solve
-    for (size_type i = 0; i < lowerLoopEnd; ++i)
+    // lower triangular solve of row i
+    auto lowerSolveRow = [&](const size_type i)
     {
         dblock rhs( md[ i ] );
         const size_type rowI     = lower_.rows_[ i ];
@@ -392,9 +452,10 @@ apply (Domain& v, const Range& d)
         }
 
         mv[ i ] = rhs;  // Lii = I
-    }
+    };
 
-    for (size_type i = upperLoopStart; i < iEnd; ++i)
+    // upper triangular solve of row i, counted from the last row
+    auto upperSolveRow = [&](const size_type i)
     {
         vblock& vBlock = mv[ lastRow - i ];
         vblock rhs ( vBlock );
@@ -408,6 +469,51 @@ apply (Domain& v, const Range& d)
 
         // apply inverse and store result
         inv_[ i ].mv( rhs, vBlock);
+    };
+
+    if (multithreaded_)
+    {
+        // The rows within a level only depend on rows of earlier levels.
+        for (int level = 0; level < lowerLevels_.size(); ++level)
+        {
+            const auto rows = lowerLevels_[level].begin();
+            const int numRows = lowerLevels_[level].size();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for (int k = 0; k < numRows; ++k)
+            {
+                if (rows[k] < lowerLoopEnd)
+                    lowerSolveRow(rows[k]);
+            }
+        }
+
+        for (int level = 0; level < upperLevels_.size(); ++level)
+        {
+            const auto rows = upperLevels_[level].begin();
+            const int numRows = upperLevels_[level].size();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for (int k = 0; k < numRows; ++k)
+            {
+                const size_type i = lastRow - rows[k];
+                if (i >= upperLoopStart)
+                    upperSolveRow(i);
+            }
+        }
+    }
+    else
+    {
+        for (size_type i = 0; i < lowerLoopEnd; ++i)
+        {
+            lowerSolveRow(i);
+        }
+
+        for (size_type i = upperLoopStart; i < iEnd; ++i)
+        {
+            upperSolveRow(i);
+        }
     }
 
     copyOwnerToAll( mv );
@@ -494,10 +600,12 @@ update()
             }
 
             // create ILU-0 decomposition
+            bool newStructure = true;
             if (ordering_.empty())
             {
                 OPM_TIMEBLOCK(iluDecompositionUpdateMatrix);
                 if (ILU_) {
+                    newStructure = false;
                     OPM_TIMEBLOCK(iluDecompositionCopyEntries);
                     // The ILU_ matrix is already a copy with the same
                     // sparse structure as A_, but the values of A_ may
@@ -542,6 +650,12 @@ update()
                 }
             }
 
+            // ILU0 keeps the sparsity pattern, so the levels are
+            // valid for both the decomposition and the solves.
+            if (multithreaded_ && (newStructure || lowerLevels_.size() == 0)) {
+                computeLevels();
+            }
+
             switch (milu_)
             {
             case MILU_VARIANT::MILU_1:
@@ -560,7 +674,9 @@ update()
                                               detail::isPositiveFunctor<typename Matrix::field_type> );
                 break;
             default:
-                if (interiorSize_ == A_->N())
+                if (multithreaded_)
+                    detail::level_scheduled_bilu0_decomposition(*ILU_, interiorSize_, lowerLevels_);
+                else if (interiorSize_ == A_->N())
                     Dune::ILU::blockILU0Decomposition( *ILU_ );
                 else
                     detail::ghost_last_bilu0_decomposition(*ILU_, interiorSize_);
@@ -583,6 +699,11 @@ update()
             }
 
             milun_decomposition( *A_, iluIteration_, milu_, *ILU_, *reorderer, *inverseReorderer );
+
+            // The fill-in changes the sparsity pattern.
+            if (multithreaded_) {
+                computeLevels();
+            }
         }
     }
     catch (const Dune::MatrixBlockError& error)
@@ -609,6 +730,15 @@ update()
     detail::convertToCRS(*ILU_, lower_, upper_, inv_);
 }
 
+template<class Matrix, class Domain, class Range, class ParallelInfoT>
+void ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
+computeLevels()
+{
+    OPM_TIMEBLOCK(computeLevels);
+    lowerLevels_ = getMatrixRowColoring(*ILU_, ColoringType::LOWER);
+    upperLevels_ = getMatrixRowColoring(*ILU_, ColoringType::UPPER);
+}
+
 template<class Matrix, class Domain, class Range, class ParallelInfoT>
 Range& ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
 reorderD(const Range& d)
@@ -0,0 +1,393 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_PIPELINEDBICGSTABSOLVER_HEADER_INCLUDED
+#define OPM_PIPELINEDBICGSTABSOLVER_HEADER_INCLUDED
+
+#include <opm/common/TimingMacros.hpp>
+
+#include <dune/common/timer.hh>
+#include <dune/istl/operators.hh>
+#include <dune/istl/owneroverlapcopy.hh>
+#include <dune/istl/paamg/pinfo.hh>
+#include <dune/istl/preconditioner.hh>
+#include <dune/istl/solver.hh>
+
+#if HAVE_MPI
+#include <dune/common/parallel/mpitraits.hh>
+#include <mpi.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <ios>
+#include <iomanip>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+namespace Opm::detail
+{
+
+/// Global sums of several dot products, reduced together with a single
+/// non-blocking collective.
+///
+/// start() computes the local contributions, counting only the owned
+/// entries in parallel, and posts the reduction. wait() completes it. Work
+/// placed between the two calls overlaps the communication latency.
+template <class X, class Comm, std::size_t N>
+class FusedDots
+{
+public:
+    using field_type = typename X::field_type;
+    using Pair = std::array<const X*, 2>;
+
+    FusedDots(const Comm& comm, [[maybe_unused]] std::size_t size)
+        : comm_(comm)
+    {
+        if constexpr (!std::is_same_v<Comm, Dune::Amg::SequentialInformation>) {
+            mask_.assign(size, 1);
+            for (const auto& idx : comm.indexSet()) {
+                if (idx.local().attribute() != Dune::OwnerOverlapCopyAttributeSet::owner) {
+                    mask_[idx.local().local()] = 0;
+                }
+            }
+        }
+    }
+
+    void start(const std::array<Pair, N>& pairs)
+    {
+        local_.fill(0);
+        const std::size_t size = pairs[0][0]->size();
+        for (std::size_t i = 0; i < size; ++i) {
+            if (!mask_.empty() && mask_[i] == 0) {
+                continue;
+            }
+            for (std::size_t k = 0; k < N; ++k) {
+                local_[k] += (*pairs[k][0])[i] * (*pairs[k][1])[i];
+            }
+        }
+#if HAVE_MPI
+        if constexpr (!std::is_same_v<Comm, Dune::Amg::SequentialInformation>) {
+            if (comm_.communicator().size() > 1) {
+                MPI_Iallreduce(local_.data(), global_.data(), N,
+                               Dune::MPITraits<field_type>::getType(),
+                               MPI_SUM, comm_.communicator(), &request_);
+                pending_ = true;
+                return;
+            }
+        }
+#endif
+        global_ = local_;
+    }
+
+    const std::array<field_type, N>& wait()
+    {
+#if HAVE_MPI
+        if (pending_) {
+            MPI_Wait(&request_, MPI_STATUS_IGNORE);
+            pending_ = false;
+        }
+#endif
+        return global_;
+    }
+
+private:
+    const Comm& comm_;
+    std::vector<char> mask_;
+    std::array<field_type, N> local_{};
+    std::array<field_type, N> global_{};
+#if HAVE_MPI
+    MPI_Request request_{};
+    bool pending_ = false;
+#endif
+};
+
+} // namespace Opm::detail
+
+namespace Dune
+{
+
+/*!
+   \brief Pipelined BiCGSTAB solver.
+
+   Preconditioned pipelined BiCGSTAB after Cools and Vanroose, "The
+   communication-hiding pipelined BiCGstab method for the parallel solution
+   of large unsymmetric linear systems", Parallel Computing 65 (2017).
+
+   Mathematically the iterates are those of right preconditioned BiCGSTAB,
+   but the recurrences are rearranged so that all inner products of an
+   iteration are gathered in two global reductions. Each reduction is
+   posted with a non-blocking allreduce and overlapped with a
+   preconditioner application followed by a matrix-vector product. Standard
+   BiCGSTAB has four blocking reductions per iteration, each of which is a
+   global synchronisation point.
+
+   The price is a number of extra vectors and vector updates. As the
+   defect is computed by recurrence it loses accuracy over many
+   iterations, so the pipeline is restarted from the true defect every
+   \p restart iterations, and whenever the recursive defect signals
+   convergence without the true one confirming it. The method pays off
+   when the latency of the reductions dominates, i.e. for many processes
+   with few cells each.
+
+   The scalar product of the solver is not used, dot products are computed
+   directly from the owner mask of the communication object.
+*/
+template <class X, class Comm>
+class PipelinedBiCGSTABSolver : public InverseOperator<X, X>
+{
+public:
+    using typename InverseOperator<X, X>::domain_type;
+    using typename InverseOperator<X, X>::range_type;
+    using typename InverseOperator<X, X>::field_type;
+    using typename InverseOperator<X, X>::real_type;
+    using typename InverseOperator<X, X>::scalar_real_type;
+
+    PipelinedBiCGSTABSolver(LinearOperator<X, X>& op,
+                            Preconditioner<X, X>& prec,
+                            scalar_real_type reduction,
+                            int restart,
+                            int maxit,
+                            int verbose,
+                            const Comm& comm)
+        : op_(op)
+        , prec_(prec)
+        , reduction_(reduction)
+        , restart_(restart)
+        , maxit_(maxit)
+        , verbose_(verbose)
+        , comm_(comm)
+    {
+    }
+
+    void apply(X& x, X& b, InverseOperatorResult& res) override
+    {
+        OPM_TIMEBLOCK(pipelinedBiCGSTAB);
+        using std::abs;
+        using std::sqrt;
+
+        Dune::Timer watch;
+        res.clear();
+
+        const std::size_t n = b.size();
+        Opm::detail::FusedDots<X, Comm, 1> dots1(comm_, n);
+        Opm::detail::FusedDots<X, Comm, 2> dots2(comm_, n);
+        Opm::detail::FusedDots<X, Comm, 3> dots3(comm_, n);
+        Opm::detail::FusedDots<X, Comm, 5> dots5(comm_, n);
+
+        // The defect is kept in b, as for the Dune solvers.
+        prec_.pre(x, b);
+        const X rhs(b);
+        X& r = b;
+
+        X rhat(x), rt(x), w(x), wt(x), t(x);
+        X pt(x), s(x), st(x), z(x), zt(x), v(x), q(x), qt(x), y(x);
+        field_type rr_old = 0;
+        field_type alpha = 0;
+        field_type beta = 0;
+        field_type omega = 0;
+
+        // Compute the true defect of x. Returns its norm.
+        auto trueDefect = [&]()
+        {
+            r = rhs;
+            op_.applyscaleadd(-1, x, r);
+            dots1.start({{{&r, &r}}});
+            return sqrt(abs(dots1.wait()[0]));
+        };
+
+        // (Re)start the pipeline from the current defect r. With beta = 0
+        // the first update overwrites the old direction vectors.
+        auto startPipeline = [&]()
+        {
+            rhat = r;
+            applyPrec(rt, r);
+            op_.apply(rt, w);
+            dots2.start({{{&rhat, &r}, {&rhat, &w}}});
+            applyPrec(wt, w);
+            op_.apply(wt, t);
+            const auto init = dots2.wait();
+            rr_old = init[0];
+            alpha = init[1] != field_type(0) ? init[0] / init[1] : field_type(0);
+            beta = 0;
+            omega = 0;
+        };
+
+        const real_type def0 = trueDefect();
+        real_type def = def0;
+        if (verbose_ > 0) {
+            std::cout << "=== PipelinedBiCGSTABSolver" << std::endl;
+            if (verbose_ > 1) {
+                printDefect(0, def0, def0);
+            }
+        }
+        if (def0 < 1e-30) {
+            res.converged = true;
+            res.iterations = 0;
+            res.reduction = 0;
+            res.conv_rate = 0;
+            res.elapsed = watch.elapsed();
+            prec_.post(x);
+            return;
+        }
+        startPipeline();
+
+        int it = 0;
+        int since_restart = 0;
+        while (it < maxit_ && alpha != field_type(0)) {
+            ++it;
+            ++since_restart;
+            for (std::size_t i = 0; i < n; ++i) {
+                pt[i].axpy(-omega, st[i]);
+                pt[i] *= beta;
+                pt[i] += rt[i];
+                s[i].axpy(-omega, z[i]);
+                s[i] *= beta;
+                s[i] += w[i];
+                st[i].axpy(-omega, zt[i]);
+                st[i] *= beta;
+                st[i] += wt[i];
+                z[i].axpy(-omega, v[i]);
+                z[i] *= beta;
+                z[i] += t[i];
+                q[i] = r[i];
+                q[i].axpy(-alpha, s[i]);
+                qt[i] = rt[i];
+                qt[i].axpy(-alpha, st[i]);
+                y[i] = w[i];
+                y[i].axpy(-alpha, z[i]);
+            }
+
+            // First reduction, hidden behind zt = M^-1 z and v = A zt.
+            dots2.start({{{&q, &y}, {&y, &y}}});
+            applyPrec(zt, z);
+            op_.apply(zt, v);
+            const auto qy_yy = dots2.wait();
+            if (qy_yy[1] == field_type(0)) {
+                break;
+            }
+            omega = qy_yy[0] / qy_yy[1];
+
+            for (std::size_t i = 0; i < n; ++i) {
+                x[i].axpy(alpha, pt[i]);
+                x[i].axpy(omega, qt[i]);
+                r[i] = q[i];
+                r[i].axpy(-omega, y[i]);
+                rt[i] = qt[i];
+                rt[i].axpy(-omega, wt[i]);
+                rt[i].axpy(omega * alpha, zt[i]);
+                w[i] = y[i];
+                w[i].axpy(-omega, t[i]);
+                w[i].axpy(omega * alpha, v[i]);
+            }
+
+            // Second reduction, hidden behind wt = M^-1 w and t = A wt.
+            dots5.start({{{&rhat, &r}, {&rhat, &w}, {&rhat, &s}, {&rhat, &z}, {&r, &r}}});
+            applyPrec(wt, w);
+            op_.apply(wt, t);
+            const auto red = dots5.wait();
+
+            const real_type def_new = sqrt(abs(red[4]));
+            if (verbose_ > 1) {
+                printDefect(it, def_new, def);
+            }
+            def = def_new;
+
+            // The recursively updated defect drifts away from the true
+            // one. Check the true defect before accepting convergence, and
+            // replace the recursive one at regular intervals.
+            const bool replace = restart_ > 0 && since_restart >= restart_;
+            if (def < def0 * reduction_ || replace) {
+                def = trueDefect();
+                if (def < def0 * reduction_) {
+                    res.converged = true;
+                    break;
+                }
+                startPipeline();
+                since_restart = 0;
+                continue;
+            }
+            if (omega == field_type(0) || rr_old == field_type(0)) {
+                break;
+            }
+
+            beta = (alpha / omega) * red[0] / rr_old;
+            rr_old = red[0];
+            const field_type denom = red[1] + beta * red[2] - beta * omega * red[3];
+            if (denom == field_type(0)) {
+                break;
+            }
+            alpha = red[0] / denom;
+        }
+
+        prec_.post(x);
+        res.iterations = it;
+        res.reduction = static_cast<double>(def / def0);
+        res.conv_rate = std::pow(res.reduction, 1.0 / std::max(it, 1));
+        res.elapsed = watch.elapsed();
+        if (verbose_ > 0) {
+            std::cout << "=== rate=" << res.conv_rate
+                      << ", T=" << res.elapsed
+                      << ", TIT=" << res.elapsed / std::max(it, 1)
+                      << ", IT=" << it << std::endl;
+        }
+    }
+
+    void apply(X& x, X& b, double reduction, InverseOperatorResult& res) override
+    {
+        const scalar_real_type saved = reduction_;
+        reduction_ = reduction;
+        apply(x, b, res);
+        reduction_ = saved;
+    }
+
+    SolverCategory::Category category() const override
+    {
+        return SolverCategory::category(op_);
+    }
+
+private:
+    void applyPrec(X& v, const X& d)
+    {
+        // Some preconditioners use v as initial guess.
+        v = 0;
+        prec_.apply(v, d);
+    }
+
+    void printDefect(int it, real_type def, real_type defOld) const
+    {
+        std::cout << std::setw(5) << it << " "
+                  << std::setw(12) << std::scientific << std::setprecision(4) << def << " "
+                  << std::setw(12) << def / defOld
+                  << std::defaultfloat << std::endl;
+    }
+
+    LinearOperator<X, X>& op_;
+    Preconditioner<X, X>& prec_;
+    scalar_real_type reduction_;
+    int restart_;
+    int maxit_;
+    int verbose_;
+    const Comm& comm_;
+};
+
+} // namespace Dune
+
+#endif // OPM_PIPELINEDBICGSTABSOLVER_HEADER_INCLUDED
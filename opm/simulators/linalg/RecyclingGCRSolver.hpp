@@ -0,0 +1,380 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_RECYCLINGGCRSOLVER_HEADER_INCLUDED
+#define OPM_RECYCLINGGCRSOLVER_HEADER_INCLUDED
+
+#include <opm/common/TimingMacros.hpp>
+
+#include <dune/common/timer.hh>
+#include <dune/istl/operators.hh>
+#include <dune/istl/preconditioner.hh>
+#include <dune/istl/scalarproducts.hh>
+#include <dune/istl/solver.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+namespace Dune
+{
+
+/*!
+   \brief Truncated GCR solver recycling a deflation space between solves.
+
+   Consecutive linear systems of a Newton loop, and of neighbouring
+   timesteps, tend to share the slowly converging modes. The solver keeps
+   a small set of vectors U spanning approximations to the eigenvectors
+   belonging to the smallest eigenvalues, and carries it over to the next
+   call of apply() on the same object, in the spirit of GCRO-DR.
+
+   At the start of a solve C = A U is recomputed for the current matrix
+   and orthonormalised. The initial residual is projected onto the
+   complement of C, and all later search directions are kept orthogonal
+   to C, which removes these modes from the Krylov iteration. The inner
+   iteration is GCR truncated to the last \p restart directions, which
+   allows a varying preconditioner such as CPR.
+
+   After the solve, the recycled space is replaced by the harmonic Ritz
+   vectors of the space spanned by U and the last search directions, using
+   the symmetric part of the projected inverse. This costs (recycle +
+   restart)^2 inner products per solve.
+
+   The recycled space lives as long as the solver object. With FlexibleSolver
+   it is therefore dropped whenever the solver is recreated.
+*/
+template <class X>
+class RecyclingGCRSolver : public InverseOperator<X, X>
+{
+public:
+    using typename InverseOperator<X, X>::domain_type;
+    using typename InverseOperator<X, X>::range_type;
+    using typename InverseOperator<X, X>::field_type;
+    using typename InverseOperator<X, X>::real_type;
+    using typename InverseOperator<X, X>::scalar_real_type;
+
+    /*!
+       \param op The linear operator.
+       \param sp The scalar product.
+       \param prec The preconditioner, which may vary between applications.
+       \param reduction The relative defect reduction to achieve.
+       \param restart Number of search directions kept by the truncated GCR.
+       \param recycle Number of vectors carried over to the next solve.
+       \param maxit Maximum number of iterations.
+       \param verbose Verbosity level.
+    */
+    RecyclingGCRSolver(LinearOperator<X, X>& op,
+                       ScalarProduct<X>& sp,
+                       Preconditioner<X, X>& prec,
+                       scalar_real_type reduction,
+                       int restart,
+                       int recycle,
+                       int maxit,
+                       int verbose)
+        : op_(op)
+        , sp_(sp)
+        , prec_(prec)
+        , reduction_(reduction)
+        , restart_(std::max(restart, 1))
+        , recycle_(std::max(recycle, 0))
+        , maxit_(maxit)
+        , verbose_(verbose)
+    {
+    }
+
+    void apply(X& x, X& b, InverseOperatorResult& res) override
+    {
+        OPM_TIMEBLOCK(recyclingGCR);
+        Dune::Timer watch;
+        res.clear();
+
+        // The defect is kept in b, as for the Dune solvers.
+        X& r = b;
+        prec_.pre(x, b);
+        op_.applyscaleadd(-1, x, r);
+        const real_type def0 = sp_.norm(r);
+
+        if (!U_.empty() && U_.front().size() != r.size()) {
+            U_.clear();
+        }
+        std::vector<X> C;
+        std::vector<X> U;
+        setupRecycledSpace(U, C);
+        for (std::size_t i = 0; i < C.size(); ++i) {
+            const field_type h = sp_.dot(C[i], r);
+            x.axpy(h, U[i]);
+            r.axpy(-h, C[i]);
+        }
+
+        real_type def = sp_.norm(r);
+        if (verbose_ > 0) {
+            std::cout << "=== RecyclingGCRSolver, recycled " << C.size() << std::endl;
+            if (verbose_ > 1) {
+                printDefect(0, def, def0);
+            }
+        }
+
+        std::vector<X> Z;
+        std::vector<X> Cz;
+        int it = 0;
+        if (def0 < 1e-30 || def < def0 * reduction_) {
+            res.converged = true;
+        }
+        while (!res.converged && it < maxit_) {
+            ++it;
+            X z(x);
+            z = 0;
+            prec_.apply(z, r);
+            X c(r);
+            op_.apply(z, c);
+            orthogonalize(z, c, U, C);
+            orthogonalize(z, c, Z, Cz);
+            const real_type norm = sp_.norm(c);
+            if (!(norm > 0) || !std::isfinite(norm)) {
+                break;
+            }
+            z /= norm;
+            c /= norm;
+
+            const field_type alpha = sp_.dot(c, r);
+            x.axpy(alpha, z);
+            r.axpy(-alpha, c);
+
+            if (static_cast<int>(Z.size()) == restart_) {
+                Z.erase(Z.begin());
+                Cz.erase(Cz.begin());
+            }
+            Z.push_back(std::move(z));
+            Cz.push_back(std::move(c));
+
+            const real_type def_new = sp_.norm(r);
+            if (verbose_ > 1) {
+                printDefect(it, def_new, def);
+            }
+            def = def_new;
+            if (def < def0 * reduction_ || def < 1e-30) {
+                res.converged = true;
+            }
+        }
+        prec_.post(x);
+
+        updateRecycledSpace(U, C, Z, Cz);
+
+        res.iterations = it;
+        res.reduction = def0 > 0 ? static_cast<double>(def / def0) : 0.0;
+        res.conv_rate = std::pow(res.reduction, 1.0 / std::max(it, 1));
+        res.elapsed = watch.elapsed();
+        if (verbose_ > 0) {
+            std::cout << "=== rate=" << res.conv_rate
+                      << ", T=" << res.elapsed
+                      << ", TIT=" << res.elapsed / std::max(it, 1)
+                      << ", IT=" << it << std::endl;
+        }
+    }
+
+    void apply(X& x, X& b, double reduction, InverseOperatorResult& res) override
+    {
+        const scalar_real_type saved = reduction_;
+        reduction_ = reduction;
+        apply(x, b, res);
+        reduction_ = saved;
+    }
+
+    SolverCategory::Category category() const override
+    {
+        return SolverCategory::category(op_);
+    }
+
+    //! \brief Number of vectors currently kept for the next solve.
+    std::size_t recycledSize() const
+    {
+        return U_.size();
+    }
+
+private:
+    //! \brief Make z and c = A z orthogonal to the orthonormal vectors in C.
+    void orthogonalize(X& z, X& c, const std::vector<X>& U, const std::vector<X>& C)
+    {
+        for (std::size_t j = 0; j < C.size(); ++j) {
+            const field_type h = sp_.dot(C[j], c);
+            c.axpy(-h, C[j]);
+            z.axpy(-h, U[j]);
+        }
+    }
+
+    //! \brief Compute C = A U for the current operator, with C orthonormal.
+    //! Vectors that become linearly dependent are dropped.
+    void setupRecycledSpace(std::vector<X>& U, std::vector<X>& C)
+    {
+        for (auto& u : U_) {
+            X c(u);
+            op_.apply(u, c);
+            const real_type norm0 = sp_.norm(c);
+            orthogonalize(u, c, U, C);
+            const real_type norm = sp_.norm(c);
+            if (!(norm > 1e-10 * norm0) || !std::isfinite(norm)) {
+                continue;
+            }
+            u /= norm;
+            c /= norm;
+            U.push_back(std::move(u));
+            C.push_back(std::move(c));
+        }
+        U_.clear();
+    }
+
+    //! \brief Replace the recycled space by harmonic Ritz vectors.
+    //!
+    //! With W = [U, Z] and the orthonormal V = A W = [C, Cz], the harmonic
+    //! Ritz values theta of A in span(W) satisfy (V^T W) y = y / theta.
+    //! The eigenvectors of the symmetric part of V^T W with the largest
+    //! eigenvalues thus approximate the eigenvectors for the smallest
+    //! eigenvalues of A.
+    void updateRecycledSpace(std::vector<X>& U, const std::vector<X>& C,
+                             std::vector<X>& Z, const std::vector<X>& Cz)
+    {
+        if (recycle_ == 0) {
+            return;
+        }
+        std::vector<X> W = std::move(U);
+        std::vector<const X*> V;
+        for (const auto& c : C) {
+            V.push_back(&c);
+        }
+        for (std::size_t j = 0; j < Z.size(); ++j) {
+            W.push_back(std::move(Z[j]));
+            V.push_back(&Cz[j]);
+        }
+        const std::size_t p = W.size();
+        if (p == 0) {
+            return;
+        }
+
+        std::vector<real_type> G(p * p);
+        for (std::size_t i = 0; i < p; ++i) {
+            for (std::size_t j = 0; j < p; ++j) {
+                G[i * p + j] = sp_.dot(*V[i], W[j]);
+            }
+        }
+        for (std::size_t i = 0; i < p; ++i) {
+            for (std::size_t j = i + 1; j < p; ++j) {
+                const real_type sym = (G[i * p + j] + G[j * p + i]) / 2;
+                G[i * p + j] = sym;
+                G[j * p + i] = sym;
+            }
+        }
+        std::vector<real_type> Y;
+        symmetricEigen(p, G, Y);
+
+        std::vector<std::size_t> order(p);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(),
+                  [&G, p](std::size_t a, std::size_t b)
+                  { return std::abs(G[a * p + a]) > std::abs(G[b * p + b]); });
+
+        const std::size_t k = std::min(p, static_cast<std::size_t>(recycle_));
+        for (std::size_t q = 0; q < k; ++q) {
+            X u(W[0]);
+            u = 0;
+            for (std::size_t j = 0; j < p; ++j) {
+                u.axpy(Y[j * p + order[q]], W[j]);
+            }
+            U_.push_back(std::move(u));
+        }
+    }
+
+    //! \brief Eigen decomposition of the small symmetric matrix A by cyclic
+    //! Jacobi rotations. On return the diagonal of A holds the eigenvalues
+    //! and the columns of V the eigenvectors.
+    static void symmetricEigen(std::size_t p, std::vector<real_type>& A, std::vector<real_type>& V)
+    {
+        V.assign(p * p, 0);
+        for (std::size_t i = 0; i < p; ++i) {
+            V[i * p + i] = 1;
+        }
+        for (int sweep = 0; sweep < 50; ++sweep) {
+            real_type off = 0;
+            real_type diag = 0;
+            for (std::size_t i = 0; i < p; ++i) {
+                diag += A[i * p + i] * A[i * p + i];
+                for (std::size_t j = i + 1; j < p; ++j) {
+                    off += A[i * p + j] * A[i * p + j];
+                }
+            }
+            if (off <= 1e-24 * diag) {
+                break;
+            }
+            for (std::size_t i = 0; i < p; ++i) {
+                for (std::size_t j = i + 1; j < p; ++j) {
+                    const real_type apq = A[i * p + j];
+                    if (apq == 0) {
+                        continue;
+                    }
+                    const real_type theta = (A[j * p + j] - A[i * p + i]) / (2 * apq);
+                    const real_type t = (theta >= 0 ? 1 : -1) / (std::abs(theta) + std::sqrt(theta * theta + 1));
+                    const real_type c = 1 / std::sqrt(t * t + 1);
+                    const real_type s = t * c;
+                    for (std::size_t k = 0; k < p; ++k) {
+                        const real_type aki = A[k * p + i];
+                        const real_type akj = A[k * p + j];
+                        A[k * p + i] = c * aki - s * akj;
+                        A[k * p + j] = s * aki + c * akj;
+                    }
+                    for (std::size_t k = 0; k < p; ++k) {
+                        const real_type aik = A[i * p + k];
+                        const real_type ajk = A[j * p + k];
+                        A[i * p + k] = c * aik - s * ajk;
+                        A[j * p + k] = s * aik + c * ajk;
+                    }
+                    for (std::size_t k = 0; k < p; ++k) {
+                        const real_type vki = V[k * p + i];
+                        const real_type vkj = V[k * p + j];
+                        V[k * p + i] = c * vki - s * vkj;
+                        V[k * p + j] = s * vki + c * vkj;
+                    }
+                }
+            }
+        }
+    }
+
+    void printDefect(int it, real_type def, real_type defOld) const
+    {
+        std::cout << std::setw(5) << it << " "
+                  << std::setw(12) << std::scientific << std::setprecision(4) << def << " "
+                  << std::setw(12) << (defOld > 0 ? def / defOld : real_type(0))
+                  << std::defaultfloat << std::endl;
+    }
+
+    LinearOperator<X, X>& op_;
+    ScalarProduct<X>& sp_;
+    Preconditioner<X, X>& prec_;
+    scalar_real_type reduction_;
+    int restart_;
+    int recycle_;
+    int maxit_;
+    int verbose_;
+    //! \brief The recycled vectors, kept between calls to apply().
+    std::vector<X> U_;
+};
+
+} // namespace Dune
+
+#endif // OPM_RECYCLINGGCRSOLVER_HEADER_INCLUDED
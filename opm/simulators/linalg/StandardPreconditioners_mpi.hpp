@@ -73,6 +73,21 @@ struct AMGSmootherArgsHelper<ParallelOverlappingILU0<M, V, V, C>>
         // smootherArgs.overlap=SmootherArgs::none;
         // smootherArgs.overlap=SmootherArgs::aggregate;
         smootherArgs.relaxationFactor = prm.get<double>("relaxation", 1.0);
+        smootherArgs.setMultithreaded(prm.get<bool>("multithreaded", false));
+        return smootherArgs;
+    }
+};
+
+template <class M, class X, class Y>
+struct AMGSmootherArgsHelper<Dune::ChebyshevSmoother<M, X, Y>>
+{
+    static auto args(const PropertyTree& prm)
+    {
+        using Smoother = Dune::ChebyshevSmoother<M, X, Y>;
+        using SmootherArgs = typename Dune::Amg::SmootherTraits<Smoother>::Arguments;
+        SmootherArgs smootherArgs;
+        // The iterations are used as the degree of the polynomial.
+        smootherArgs.iterations = prm.get<int>("iterations", 2);
         return smootherArgs;
     }
 };
@@ -167,6 +182,12 @@ struct StandardPreconditioners
             DUNE_UNUSED_PARAMETER(prm);
             return wrapBlockPreconditioner<MultithreadDILU<M, V, V>>(comm, op.getmat());
         });
+        F::addCreator("chebyshev", [](const O& op, const P& prm, const std::function<V()>&, std::size_t, const C& comm) {
+            const int degree = prm.get<int>("degree", 2);
+            const double ratio = prm.get<double>("eigenvalue_ratio", 30.0);
+            const int power_iterations = prm.get<int>("power_iterations", 10);
+            return wrapBlockPreconditioner<ChebyshevSmoother<M, V, V>>(comm, op.getmat(), degree, ratio, power_iterations);
+        });
 #if HAVE_AVX2_EXTENSION
         F::addCreator("mixed-ilu0", [](const O& op, const P& prm, const std::function<V()>&, std::size_t, const C& comm) {
             DUNE_UNUSED_PARAMETER(prm);
@@ -274,6 +295,13 @@ struct StandardPreconditioners
                     auto crit = AMGHelper<O, C, M, V>::criterion(prm);
                     PrecPtr prec = std::make_shared<Dune::Amg::AMGCPR<O, V, Smoother, C>>(op, crit, sargs, comm);
                     return prec;
+                } else if (smoother == "chebyshev") {
+                    using SeqSmoother = Dune::ChebyshevSmoother<M, V, V>;
+                    using Smoother = Dune::BlockPreconditioner<V, V, C, SeqSmoother>;
+                    auto sargs = AMGSmootherArgsHelper<SeqSmoother>::args(prm);
+                    auto crit = AMGHelper<O, C, M, V>::criterion(prm);
+                    PrecPtr prec = std::make_shared<Dune::Amg::AMGCPR<O, V, Smoother, C>>(op, crit, sargs, comm);
+                    return prec;
                 } else {
                     OPM_THROW(std::invalid_argument, "Properties: No smoother with name " + smoother + ".");
                 }
@@ -432,15 +460,18 @@ struct StandardPreconditioners
         const double w = prm.get<double>("relaxation", 1.0);
         const bool redblack = prm.get<bool>("redblack", false);
         const bool reorder_spheres = prm.get<bool>("reorder_spheres", false);
+        const bool multithreaded = prm.get<bool>("multithreaded", false);
         // Already a parallel preconditioner. Need to pass comm, but no need to wrap it in a BlockPreconditioner.
         if (ilulevel == 0) {
             const std::size_t num_interior = interiorIfGhostLast(comm);
             assert(num_interior <= op.getmat().N());
             return std::make_shared<ParallelOverlappingILU0<M, V, V, Comm>>(
-                op.getmat(), comm, w, MILU_VARIANT::ILU, num_interior, redblack, reorder_spheres);
+                op.getmat(), comm, w, MILU_VARIANT::ILU, num_interior, redblack, reorder_spheres,
+                multithreaded);
         } else {
             return std::make_shared<ParallelOverlappingILU0<M, V, V, Comm>>(
-                op.getmat(), comm, ilulevel, w, MILU_VARIANT::ILU, redblack, reorder_spheres);
+                op.getmat(), comm, ilulevel, w, MILU_VARIANT::ILU, redblack, reorder_spheres,
+                multithreaded);
         }
     }
 
@@ -37,6 +37,10 @@
 #include <opm/simulators/linalg/mixed/PreconditionerWrapper.hpp>
 #endif
 
+#if FLOW_INSTANTIATE_FLOAT
+#include <opm/simulators/linalg/MixedPrecisionPreconditioner.hpp>
+#endif
+
 namespace Opm {
 
 template <class X, class Y>
@@ -67,8 +71,9 @@ struct StandardPreconditioners<Operator, Dune::Amg::SequentialInformation, typen
         using P = PropertyTree;
         F::addCreator("ilu0", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
             const double w = prm.get<double>("relaxation", 1.0);
+            const bool multithreaded = prm.get<bool>("multithreaded", false);
             return std::make_shared<ParallelOverlappingILU0<M, V, V, C>>(
-                op.getmat(), 0, w, MILU_VARIANT::ILU);
+                op.getmat(), 0, w, MILU_VARIANT::ILU, false, true, multithreaded);
         });
         F::addCreator("duneilu", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
             const double w = prm.get<double>("relaxation", 1.0);
@@ -79,19 +84,27 @@ struct StandardPreconditioners<Operator, Dune::Amg::SequentialInformation, typen
         F::addCreator("paroverilu0", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
             const double w = prm.get<double>("relaxation", 1.0);
             const int n = prm.get<int>("ilulevel", 0);
+            const bool multithreaded = prm.get<bool>("multithreaded", false);
             return std::make_shared<ParallelOverlappingILU0<M, V, V, C>>(
-                op.getmat(), n, w, MILU_VARIANT::ILU);
+                op.getmat(), n, w, MILU_VARIANT::ILU, false, true, multithreaded);
         });
         F::addCreator("ilun", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
             const int n = prm.get<int>("ilulevel", 0);
             const double w = prm.get<double>("relaxation", 1.0);
+            const bool multithreaded = prm.get<bool>("multithreaded", false);
             return std::make_shared<ParallelOverlappingILU0<M, V, V, C>>(
-                op.getmat(), n, w, MILU_VARIANT::ILU);
+                op.getmat(), n, w, MILU_VARIANT::ILU, false, true, multithreaded);
         });
         F::addCreator("dilu", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
             DUNE_UNUSED_PARAMETER(prm);
             return std::make_shared<MultithreadDILU<M, V, V>>(op.getmat());
         });
+        F::addCreator("chebyshev", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
+            const int degree = prm.get<int>("degree", 2);
+            const double ratio = prm.get<double>("eigenvalue_ratio", 30.0);
+            const int power_iterations = prm.get<int>("power_iterations", 10);
+            return std::make_shared<ChebyshevSmoother<M, V, V>>(op.getmat(), degree, ratio, power_iterations);
+        });
 #if HAVE_AVX2_EXTENSION
         F::addCreator("mixed-ilu0", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
             DUNE_UNUSED_PARAMETER(prm);
@@ -171,6 +184,9 @@ struct StandardPreconditioners<Operator, Dune::Amg::SequentialInformation, typen
                 } else if (smoother == "ilun") {
                     using Smoother = SeqILU<M, V, V>;
                     return AMGHelper<O, C, M, V>::template makeAmgPreconditioner<Smoother>(op, prm);
+                } else if (smoother == "chebyshev") {
+                    using Smoother = ChebyshevSmoother<M, V, V>;
+                    return AMGHelper<O, C, M, V>::template makeAmgPreconditioner<Smoother>(op, prm);
                 } else {
                     OPM_THROW(std::invalid_argument, "Properties: No smoother with name " + smoother + ".");
                 }
@@ -197,6 +213,9 @@ struct StandardPreconditioners<Operator, Dune::Amg::SequentialInformation, typen
                 } else if (smoother == "ilun") {
                     using Smoother = SeqILU<M, V, V>;
                     return AMGHelper<O, C, M, V>::template makeAmgPreconditioner<Smoother>(op, prm, true);
+                } else if (smoother == "chebyshev") {
+                    using Smoother = ChebyshevSmoother<M, V, V>;
+                    return AMGHelper<O, C, M, V>::template makeAmgPreconditioner<Smoother>(op, prm, true);
                 } else {
                     OPM_THROW(std::invalid_argument, "Properties: No smoother with name " + smoother + ".");
                 }
@@ -278,6 +297,25 @@ struct StandardPreconditioners<Operator, Dune::Amg::SequentialInformation, typen
                     op, prm, weightsCalculator, pressureIndex);
             });
 
+#if FLOW_INSTANTIATE_FLOAT
+        // CPR with the coarse system, the AMG hierarchy and the fine smoother
+        // in float, for use with a double precision Krylov solver. This needs
+        // the float instantiations of the preconditioners and FlexibleSolver.
+        if constexpr (std::is_same_v<typename V::field_type, double>) {
+            F::addCreator(
+                "cprfloat",
+                [](const O& op, const P& prm, const std::function<V()>& weightsCalculator, std::size_t pressureIndex) {
+                    if (pressureIndex == std::numeric_limits<std::size_t>::max()) {
+                        OPM_THROW(std::logic_error, "Pressure index out of bounds. It needs to specified for CPR");
+                    }
+                    auto float_prm = prm;
+                    float_prm.put("type", std::string("cpr"));
+                    return std::make_shared<MixedPrecisionPreconditioner<M, V, V>>(
+                        op.getmat(), float_prm, weightsCalculator, pressureIndex);
+                });
+        }
+#endif
+
 #if HAVE_CUDA
         // Here we create the *wrapped* GPU preconditioners
         // meaning they will act as CPU preconditioners on the outside,
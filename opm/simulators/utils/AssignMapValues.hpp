@@ -0,0 +1,54 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_ASSIGN_MAP_VALUES_HEADER_INCLUDED
+#define OPM_ASSIGN_MAP_VALUES_HEADER_INCLUDED
+
+#include <algorithm>
+
+namespace Opm
+{
+
+/// Copy the ordered map from into to.
+///
+/// The copy assignment operator of std::map destroys and reconstructs
+/// the values of all nodes, so mapped containers such as vectors are
+/// reallocated on every copy. When both maps hold the same keys, which
+/// is the common case when a state is repeatedly saved and restored,
+/// the mapped values are instead assigned in place and keep their
+/// storage. Otherwise this falls back to the copy assignment.
+template<class Map>
+void assignMapValues(Map& to, const Map& from)
+{
+    const bool same_keys =
+        to.size() == from.size() &&
+        std::equal(to.begin(), to.end(), from.begin(),
+                   [](const auto& x, const auto& y) { return x.first == y.first; });
+    if (!same_keys) {
+        to = from;
+        return;
+    }
+
+    auto it = to.begin();
+    for (const auto& [key, value] : from) {
+        (it++)->second = value;
+    }
+}
+
+} // namespace Opm
+
+#endif // OPM_ASSIGN_MAP_VALUES_HEADER_INCLUDED
@@ -0,0 +1,289 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_FLAT_ID_MAP_HEADER_INCLUDED
+#define OPM_FLAT_ID_MAP_HEADER_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Opm
+{
+
+/// Hash map from 64 bit ids, such as the ids of cell pairs used for
+/// transmissibilities, to values.
+///
+/// The entries are stored in a single flat array using open addressing
+/// with linear probing, which avoids the per-entry allocations of
+/// std::unordered_map and keeps lookups cache friendly. The interface is
+/// the subset of the std::unordered_map interface needed by its users.
+/// Iterators and references are invalidated by insertions that grow the
+/// table. Entries can not be erased, and the id with all bits set is
+/// reserved to mark empty slots.
+template<class Value>
+class FlatIdMap
+{
+public:
+    using key_type = std::uint64_t;
+    using mapped_type = Value;
+    using value_type = std::pair<key_type, mapped_type>;
+    using size_type = std::size_t;
+
+    template<bool IsConst>
+    class Iterator
+    {
+        using Slots = std::conditional_t<IsConst,
+                                         const std::vector<FlatIdMap::value_type>,
+                                         std::vector<FlatIdMap::value_type>>;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = FlatIdMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+        using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+        Iterator() = default;
+
+        Iterator(Slots* slots, size_type pos)
+            : slots_(slots), pos_(pos)
+        {
+            skipEmpty();
+        }
+
+        //! Allow conversion from iterator to const_iterator.
+        template<bool C = IsConst, std::enable_if_t<C, int> = 0>
+        Iterator(const Iterator<false>& other)
+            : slots_(other.slots_), pos_(other.pos_)
+        {}
+
+        reference operator*() const { return (*slots_)[pos_]; }
+        pointer operator->() const { return &(*slots_)[pos_]; }
+
+        Iterator& operator++()
+        {
+            ++pos_;
+            skipEmpty();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const Iterator& other) const
+        { return pos_ == other.pos_; }
+
+        bool operator!=(const Iterator& other) const
+        { return pos_ != other.pos_; }
+
+    private:
+        friend class Iterator<true>;
+
+        void skipEmpty()
+        {
+            while (pos_ < slots_->size() && (*slots_)[pos_].first == emptyKey) {
+                ++pos_;
+            }
+        }
+
+        Slots* slots_ = nullptr;
+        size_type pos_ = 0;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    bool empty() const { return size_ == 0; }
+    size_type size() const { return size_; }
+
+    //! \brief Remove all entries, keeping the allocated table.
+    void clear()
+    {
+        for (auto& slot : slots_) {
+            slot.first = emptyKey;
+        }
+        size_ = 0;
+    }
+
+    //! \brief Make room for at least n entries without growing the table.
+    void reserve(const size_type n)
+    {
+        if (n > maxSize(slots_.size())) {
+            rehash(capacityFor(n));
+        }
+    }
+
+    iterator begin() { return iterator(&slots_, 0); }
+    iterator end() { return iterator(&slots_, slots_.size()); }
+    const_iterator begin() const { return const_iterator(&slots_, 0); }
+    const_iterator end() const { return const_iterator(&slots_, slots_.size()); }
+
+    iterator find(const key_type key)
+    {
+        const size_type pos = probe(key);
+        return (pos < slots_.size() && slots_[pos].first == key) ? iterator(&slots_, pos) : end();
+    }
+
+    const_iterator find(const key_type key) const
+    {
+        const size_type pos = probe(key);
+        return (pos < slots_.size() && slots_[pos].first == key) ? const_iterator(&slots_, pos) : end();
+    }
+
+    size_type count(const key_type key) const
+    { return find(key) != end() ? 1 : 0; }
+
+    mapped_type& at(const key_type key)
+    {
+        auto it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("FlatIdMap::at: key not found");
+        }
+        return it->second;
+    }
+
+    const mapped_type& at(const key_type key) const
+    {
+        auto it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("FlatIdMap::at: key not found");
+        }
+        return it->second;
+    }
+
+    mapped_type& operator[](const key_type key)
+    { return emplace(key, mapped_type{}).first->second; }
+
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(const key_type key, M&& value)
+    {
+        auto result = emplace(key, std::forward<M>(value));
+        if (!result.second) {
+            result.first->second = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    template<class M>
+    std::pair<iterator, bool> emplace(const key_type key, M&& value)
+    {
+        size_type pos = probe(key);
+        if (pos < slots_.size() && slots_[pos].first == key) {
+            return {iterator(&slots_, pos), false};
+        }
+        // only grow the table when a new key is actually inserted
+        if (size_ + 1 > maxSize(slots_.size())) {
+            rehash(capacityFor(size_ + 1));
+            pos = probe(key);
+        }
+        slots_[pos] = value_type(key, std::forward<M>(value));
+        ++size_;
+        return {iterator(&slots_, pos), true};
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    { return emplace(value.first, value.second); }
+
+    bool operator==(const FlatIdMap& other) const
+    {
+        if (size_ != other.size_) {
+            return false;
+        }
+        for (const auto& [key, value] : *this) {
+            auto it = other.find(key);
+            if (it == other.end() || !(it->second == value)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    static constexpr key_type emptyKey = std::numeric_limits<key_type>::max();
+    static constexpr size_type minCapacity = 16;
+
+    //! Largest number of entries in a table of the given capacity,
+    //! corresponding to a maximum load factor of 0.75.
+    static size_type maxSize(const size_type capacity)
+    { return capacity - capacity / 4; }
+
+    //! Smallest power of two capacity holding n entries.
+    static size_type capacityFor(const size_type n)
+    {
+        size_type capacity = minCapacity;
+        while (maxSize(capacity) < n) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    size_type slotOf(const key_type key) const
+    {
+        // Fibonacci hashing spreads the consecutive cell indices
+        // making up the ids over the whole table.
+        const key_type h = key * 0x9E3779B97F4A7C15ULL;
+        return static_cast<size_type>(h ^ (h >> 32)) & (slots_.size() - 1);
+    }
+
+    //! Slot holding the key, or the empty slot where it would be inserted.
+    //! Returns the table size for an empty table.
+    size_type probe(const key_type key) const
+    {
+        if (slots_.empty()) {
+            return 0;
+        }
+        const size_type mask = slots_.size() - 1;
+        size_type pos = slotOf(key);
+        while (slots_[pos].first != key && slots_[pos].first != emptyKey) {
+            pos = (pos + 1) & mask;
+        }
+        return pos;
+    }
+
+    void rehash(const size_type capacity)
+    {
+        std::vector<value_type> old(capacity, value_type(emptyKey, mapped_type{}));
+        old.swap(slots_);
+        const size_type mask = slots_.size() - 1;
+        for (auto& slot : old) {
+            if (slot.first != emptyKey) {
+                size_type pos = slotOf(slot.first);
+                while (slots_[pos].first != emptyKey) {
+                    pos = (pos + 1) & mask;
+                }
+                slots_[pos] = std::move(slot);
+            }
+        }
+    }
+
+    std::vector<value_type> slots_;
+    size_type size_ = 0;
+};
+
+} // namespace Opm
+
+#endif // OPM_FLAT_ID_MAP_HEADER_INCLUDED
@@ -26,9 +26,11 @@
 
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <filesystem>
+#include <numeric>
 #include <stdexcept>
 
 //! \brief True on HDF5 newer than 1.8, which is where H5Lexists and the
@@ -42,6 +44,11 @@
 
 namespace {
 
+//! \brief Chunk size for collectively written datasets.
+//! \details Bounds the memory used by the deflate filter, and lets the chunks
+//!          be compressed by the processes owning most of their data.
+constexpr hsize_t collectiveChunkSize = 4 * 1024 * 1024;
+
 bool groupExists(hid_t parent, const std::string& path)
 {
   // turn off errors to avoid cout spew
@@ -61,8 +68,10 @@ namespace Opm {
 
 HDF5File::HDF5File(const std::string& fileName,
                    OpenMode mode,
-                   Parallel::Communication comm)
+                   Parallel::Communication comm,
+                   bool compress)
     : comm_(comm)
+    , compress_(compress)
 {
     bool exists = std::filesystem::exists(fileName);
     hid_t acc_tpl = H5P_DEFAULT;
@@ -114,7 +123,7 @@ void HDF5File::write(const std::string& group,
 {
     hid_t grp = H5I_INVALID_HID;
     std::string realGroup = group;
-    if (mode == DataSetMode::PROCESS_SPLIT) {
+    if (mode != DataSetMode::ROOT_ONLY) {
         if (group != "/")
             realGroup += '/';
         realGroup += dset;
@@ -136,6 +145,9 @@ void HDF5File::write(const std::string& group,
     if (mode == DataSetMode::PROCESS_SPLIT) {
         writeSplit(grp, buffer, realGroup);
     }
+    else if (mode == DataSetMode::COLLECTIVE) {
+        writeCollective(grp, buffer, realGroup);
+    }
     else if (mode == DataSetMode::ROOT_ONLY) {
         writeRootOnly(grp, buffer, group, dset);
     }
@@ -150,7 +162,11 @@ void HDF5File::read(const std::string& group,
                     DataSetMode mode) const
 {
     std::string realSet = group + '/' + dset;
-    if (mode == DataSetMode::PROCESS_SPLIT) {
+    if (mode != DataSetMode::ROOT_ONLY && groupExists(m_file, realSet + "/offsets")) {
+        readCollective(realSet, buffer);
+        return;
+    }
+    if (mode != DataSetMode::ROOT_ONLY) {
         realSet += '/' + std::to_string(comm_.rank());
     }
     hid_t dataset_id = H5Dopen2(m_file, realSet.c_str(), H5P_DEFAULT);
@@ -197,8 +213,7 @@ void HDF5File::writeSplit(hid_t grp,
 #if HAVE_MPI && H5_HAVE_PARALLEL
         hsize_t lsize = buffer.size();
         comm_.allgather(&lsize, 1, proc_sizes.data());
-        dxpl = H5Pcreate(H5P_DATASET_XFER);
-        H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+        dxpl = this->getCollectiveTransfer();
 #else
         assert(false); // should be unreachable
 #endif
@@ -209,7 +224,7 @@ void HDF5File::writeSplit(hid_t grp,
 
     for (int i = 0; i < comm_.size(); ++i) {
         hid_t space = H5Screate_simple(1, &proc_sizes[i], nullptr);
-        hid_t dcpl = this->getCompression(proc_sizes[i]);
+        hid_t dcpl = this->getCompression(proc_sizes[i], proc_sizes[i]);
         hid_t dataset_id = H5Dcreate2(grp,
                                       std::to_string(i).c_str(),
                                       H5T_NATIVE_CHAR, space,
@@ -235,6 +250,131 @@ void HDF5File::writeSplit(hid_t grp,
     }
 }
 
+void HDF5File::writeCollective(hid_t grp,
+                               const std::vector<char>& buffer,
+                               const std::string& dset) const
+{
+    std::vector<hsize_t> proc_sizes(comm_.size());
+    hid_t dxpl = H5P_DEFAULT;
+    if (comm_.size() > 1) {
+#if HAVE_MPI && H5_HAVE_PARALLEL
+        hsize_t lsize = buffer.size();
+        comm_.allgather(&lsize, 1, proc_sizes.data());
+        dxpl = this->getCollectiveTransfer();
+#else
+        assert(false); // should be unreachable
+#endif
+    }
+    else {
+        proc_sizes[0] = buffer.size();
+    }
+
+    // Process i owns the range [offsets[i], offsets[i+1]) of the dataset
+    std::vector<unsigned long long> offsets(comm_.size() + 1, 0);
+    std::partial_sum(proc_sizes.begin(), proc_sizes.end(), offsets.begin() + 1);
+    hsize_t total = offsets.back();
+
+    hid_t space = H5Screate_simple(1, &total, nullptr);
+    hid_t dcpl = this->getCompression(total, std::min(total, collectiveChunkSize));
+    hid_t dataset_id = H5Dcreate2(grp, "data",
+                                  H5T_NATIVE_CHAR, space,
+                                  H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    if (dcpl != H5P_DEFAULT) {
+        H5Pclose(dcpl);
+    }
+    if (dataset_id == H5I_INVALID_HID) {
+        H5Sclose(space);
+        if (dxpl != H5P_DEFAULT) {
+            H5Pclose(dxpl);
+        }
+        throw std::runtime_error("Trying to write already existing dataset '" +
+                                 dset + "/data'");
+    }
+
+    hsize_t start = offsets[comm_.rank()];
+    hsize_t lsize = proc_sizes[comm_.rank()];
+    hsize_t stride = 1;
+    H5Sselect_hyperslab(space, H5S_SELECT_SET, &start, &stride, &lsize, nullptr);
+    hid_t memspace = H5Screate_simple(1, &lsize, nullptr);
+    H5Dwrite(dataset_id, H5T_NATIVE_CHAR, memspace, space, dxpl, buffer.data());
+    H5Sclose(memspace);
+    H5Dclose(dataset_id);
+    H5Sclose(space);
+
+    hsize_t noffsets = offsets.size();
+    space = H5Screate_simple(1, &noffsets, nullptr);
+    dataset_id = H5Dcreate2(grp, "offsets",
+                            H5T_NATIVE_ULLONG, space,
+                            H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    if (dataset_id == H5I_INVALID_HID) {
+        H5Sclose(space);
+        if (dxpl != H5P_DEFAULT) {
+            H5Pclose(dxpl);
+        }
+        throw std::runtime_error("Trying to write already existing dataset '" +
+                                 dset + "/offsets'");
+    }
+    writeDset(0, dataset_id, dxpl, noffsets, offsets.data(), H5T_NATIVE_ULLONG);
+    H5Dclose(dataset_id);
+    H5Sclose(space);
+    if (dxpl != H5P_DEFAULT) {
+        H5Pclose(dxpl);
+    }
+}
+
+void HDF5File::readCollective(const std::string& realGroup,
+                              std::vector<char>& buffer) const
+{
+    hid_t offsets_id = H5Dopen2(m_file, (realGroup + "/offsets").c_str(), H5P_DEFAULT);
+    hid_t dataset_id = H5Dopen2(m_file, (realGroup + "/data").c_str(), H5P_DEFAULT);
+    if (offsets_id == H5I_INVALID_HID || dataset_id == H5I_INVALID_HID) {
+        if (offsets_id != H5I_INVALID_HID) {
+            H5Dclose(offsets_id);
+        }
+        if (dataset_id != H5I_INVALID_HID) {
+            H5Dclose(dataset_id);
+        }
+        throw std::runtime_error("Trying to read broken collective dataset " + realGroup);
+    }
+
+    hid_t space = H5Dget_space(offsets_id);
+    std::vector<unsigned long long> offsets(H5Sget_simple_extent_npoints(space));
+    H5Sclose(space);
+    H5Dread(offsets_id, H5T_NATIVE_ULLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, offsets.data());
+    H5Dclose(offsets_id);
+    if (offsets.size() != static_cast<std::size_t>(comm_.size()) + 1) {
+        H5Dclose(dataset_id);
+        throw std::runtime_error("Dataset " + realGroup + " was written by " +
+                                 std::to_string(offsets.size() - 1) +
+                                 " processes, cannot read it with " +
+                                 std::to_string(comm_.size()));
+    }
+
+    hid_t dxpl = H5P_DEFAULT;
+    if (comm_.size() > 1) {
+#if HAVE_MPI && H5_HAVE_PARALLEL
+        dxpl = this->getCollectiveTransfer();
+#else
+        assert(false); // should be unreachable
+#endif
+    }
+
+    hsize_t start = offsets[comm_.rank()];
+    hsize_t lsize = offsets[comm_.rank() + 1] - start;
+    hsize_t stride = 1;
+    buffer.resize(lsize);
+    space = H5Dget_space(dataset_id);
+    H5Sselect_hyperslab(space, H5S_SELECT_SET, &start, &stride, &lsize, nullptr);
+    hid_t memspace = H5Screate_simple(1, &lsize, nullptr);
+    H5Dread(dataset_id, H5T_NATIVE_CHAR, memspace, space, dxpl, buffer.data());
+    H5Sclose(memspace);
+    H5Sclose(space);
+    H5Dclose(dataset_id);
+    if (dxpl != H5P_DEFAULT) {
+        H5Pclose(dxpl);
+    }
+}
+
 void HDF5File::writeRootOnly(hid_t grp,
                              const std::vector<char>& buffer,
                              const std::string& group,
@@ -243,12 +383,11 @@ void HDF5File::writeRootOnly(hid_t grp,
     hsize_t size = buffer.size();
     comm_.broadcast(&size, 1, 0);
     hid_t space = H5Screate_simple(1, &size, nullptr);
-    hid_t dcpl = this->getCompression(size);
+    hid_t dcpl = this->getCompression(size, size);
     hid_t dxpl = H5P_DEFAULT;
     if (comm_.size() > 1) {
 #if HAVE_MPI && H5_HAVE_PARALLEL
-        dxpl = H5Pcreate(H5P_DATASET_XFER);
-        H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+        dxpl = this->getCollectiveTransfer();
 #else
         assert(false); // should be unreachable
 #endif
@@ -272,24 +411,36 @@ void HDF5File::writeRootOnly(hid_t grp,
     }
 }
 
-hid_t HDF5File::getCompression([[maybe_unused]] hsize_t size) const
+hid_t HDF5File::getCompression([[maybe_unused]] hsize_t size,
+                               [[maybe_unused]] hsize_t chunk) const
 {
     hid_t dcpl = H5P_DEFAULT;
 #if OPM_HDF5_AFTER_1_8
     // A chunk dimension of zero is an error, so an empty dataset (a rank with
     // no local data) has to stay contiguous. There is nothing to compress
     // there anyway.
-    if (size > 0 && H5Zfilter_avail(H5Z_FILTER_DEFLATE) != 0) {
+    if (compress_ && size > 0 && H5Zfilter_avail(H5Z_FILTER_DEFLATE) != 0) {
         dcpl = H5Pcreate(H5P_DATASET_CREATE);
         H5Pset_deflate(dcpl, 1);
-        H5Pset_chunk(dcpl, 1, &size);
+        H5Pset_chunk(dcpl, 1, &chunk);
     }
 #endif
     return dcpl;
 }
 
+hid_t HDF5File::getCollectiveTransfer() const
+{
+    hid_t dxpl = H5P_DEFAULT;
+#if HAVE_MPI && H5_HAVE_PARALLEL
+    dxpl = H5Pcreate(H5P_DATASET_XFER);
+    H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+#endif
+    return dxpl;
+}
+
 void HDF5File::writeDset(int rank, hid_t dataset_id,
-                         hid_t dxpl, hsize_t size, const void* data) const
+                         hid_t dxpl, hsize_t size, const void* data,
+                         hid_t type) const
 {
     hid_t filespace = H5Dget_space(dataset_id);
     hsize_t stride = 1;
@@ -297,7 +448,7 @@ void HDF5File::writeDset(int rank, hid_t dataset_id,
     hsize_t lsize = comm_.rank() == rank ? size : 0;
     H5Sselect_hyperslab(filespace, H5S_SELECT_SET, &start, &stride, &lsize, nullptr);
     hid_t memspace = H5Screate_simple(1, &lsize, nullptr);
-    H5Dwrite(dataset_id, H5T_NATIVE_CHAR, memspace, filespace, dxpl, data);
+    H5Dwrite(dataset_id, type, memspace, filespace, dxpl, data);
     H5Sclose(memspace);
     H5Sclose(filespace);
 }
@@ -43,16 +43,20 @@ public:
     //! \brief Enumeration of dataset modes.
     enum class DataSetMode {
         ROOT_ONLY,     //!< A single dataset created at the root process
-        PROCESS_SPLIT  //!< One separate data set for each parallel process
+        PROCESS_SPLIT, //!< One separate data set for each parallel process
+        COLLECTIVE     //!< Data of all processes stored back to back in a
+                       //!< single data set, written collectively
     };
 
     //! \brief Opens HDF5 file for I/O.
     //! \param fileName Name of file to open
     //! \param mode Open mode for file
     //! \param comm Parallel communicator
+    //! \param compress True to deflate compress written data sets
     HDF5File(const std::string& fileName,
              OpenMode mode,
-             Parallel::Communication comm);
+             Parallel::Communication comm,
+             bool compress = true);
 
     //! \brief Destructor clears up any opened files.
     ~HDF5File();
@@ -73,7 +77,9 @@ public:
     //! \param dset Data set ("file") to read data from
     //! \param buffer Vector to store read data in
     //! \param mode Mode for dataset
-    //! \details Throws exception on failure
+    //! \details Throws exception on failure.
+    //!          PROCESS_SPLIT and COLLECTIVE data sets are told apart by
+    //!          their layout in the file, so either mode reads both.
     void read(const std::string& group,
               const std::string& dset,
               std::vector<char>& buffer,
@@ -92,6 +98,22 @@ private:
                     const std::vector<char>& buffer,
                     const std::string& dset) const;
 
+    //! \brief Write data from all processes collectively to a single dataset.
+    //! \param grp Handle for group to store dataset in
+    //! \param buffer Data to write
+    //! \param dset Name of dataset
+    //! \details The data is stored in the dataset 'data', with the process
+    //!          offsets into it in the dataset 'offsets'.
+    void writeCollective(hid_t grp,
+                         const std::vector<char>& buffer,
+                         const std::string& dset) const;
+
+    //! \brief Read the part of a collectively written dataset for this process.
+    //! \param realGroup Group holding the collective dataset
+    //! \param buffer Vector to store read data in
+    void readCollective(const std::string& realGroup,
+                        std::vector<char>& buffer) const;
+
     //! \brief Write data from root process only.
     //! \param grp Handle for group to store dataset in
     //! \param buffer Data to write
@@ -103,7 +125,11 @@ private:
 
     //! \brief Return a dataset creation properly list with compression settings.
     //! \param size Size of dataset
-    hid_t getCompression(hsize_t size) const;
+    //! \param chunk Size of chunks the dataset is compressed in
+    hid_t getCompression(hsize_t size, hsize_t chunk) const;
+
+    //! \brief Return a dataset transfer property list for collective I/O.
+    hid_t getCollectiveTransfer() const;
 
     //! \brief Helper function to write a dataset.
     //! \param rank Process rank that should write
@@ -111,8 +137,10 @@ private:
     //! \param dxpl Dataset transfer property list
     //! \param size Size of dataset
     //! \param data Data to write
+    //! \param type Type of data to write
     void writeDset(int rank, hid_t dataset_id,
-                   hid_t dxpl, hsize_t size, const void* data) const;
+                   hid_t dxpl, hsize_t size, const void* data,
+                   hid_t type = H5T_NATIVE_CHAR) const;
 
     //! \brief Create groups.
     //! \param realGroup Path for groups to create
@@ -120,6 +148,7 @@ private:
 
     hid_t m_file = H5I_INVALID_HID; //!< File handle
     Parallel::Communication comm_;
+    bool compress_; //!< True to compress written datasets
 };
 
 }
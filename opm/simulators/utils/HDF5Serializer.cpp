@@ -22,7 +22,77 @@
 #include <opm/simulators/utils/HDF5Serializer.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <cstdlib>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// The packed buffers are split in chunks at positions given by a rolling
+// hash of the preceding bytes, so the chunk boundaries follow the data when
+// the size of a field earlier in the buffer changes. The reader splits the
+// base dataset the same way, so the parameters are part of the file format.
+constexpr std::size_t minChunkSize = 1024;
+constexpr std::size_t maxChunkSize = 16384;
+constexpr std::uint64_t chunkMask = 0xfffull << 52;
+
+constexpr std::array<std::uint64_t, 256> makeGearTable()
+{
+    // splitmix64 sequence
+    std::array<std::uint64_t, 256> table{};
+    std::uint64_t state = 0;
+    for (auto& entry : table) {
+        state += 0x9e3779b97f4a7c15ull;
+        std::uint64_t z = state;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        entry = z ^ (z >> 31);
+    }
+    return table;
+}
+
+constexpr auto gearTable = makeGearTable();
+
+//! \brief Returns the end of each chunk of a buffer.
+std::vector<std::size_t> chunkEnds(const std::vector<char>& buffer)
+{
+    std::vector<std::size_t> ends;
+    std::uint64_t hash = 0;
+    std::size_t begin = 0;
+    for (std::size_t i = 0; i < buffer.size(); ++i) {
+        hash = (hash << 1) + gearTable[static_cast<unsigned char>(buffer[i])];
+        const std::size_t len = i + 1 - begin;
+        if ((len >= minChunkSize && (hash & chunkMask) == 0) || len == maxChunkSize) {
+            ends.push_back(i + 1);
+            begin = i + 1;
+            hash = 0;
+        }
+    }
+    if (begin < buffer.size()) {
+        ends.push_back(buffer.size());
+    }
+    return ends;
+}
+
+//! \brief Returns a 128 bit hash of a chunk.
+std::array<std::uint64_t, 2> chunkHash(const char* data, std::size_t len)
+{
+    // FNV-1a and a multiplicative hash with a different mixing
+    std::uint64_t h1 = 0xcbf29ce484222325ull;
+    std::uint64_t h2 = 0x9e3779b97f4a7c15ull ^ len;
+    for (std::size_t i = 0; i < len; ++i) {
+        const auto c = static_cast<unsigned char>(data[i]);
+        h1 = (h1 ^ c) * 0x100000001b3ull;
+        h2 = (h2 + c) * 0xff51afd7ed558ccdull;
+        h2 ^= h2 >> 29;
+    }
+    return {h1, h2};
+}
+
+} // Anonymous namespace
 
 namespace Opm {
 
@@ -43,6 +113,122 @@ void HDF5Serializer::writeHeader(const std::string& simulator_name,
     m_h5file.write("/", "simulator_info", m_buffer, HDF5File::DataSetMode::ROOT_ONLY);
 }
 
+void HDF5Serializer::writeDelta(const std::string& group,
+                                const std::string& dset,
+                                HDF5File::DataSetMode mode)
+{
+    const auto ends = chunkEnds(m_buffer);
+    auto it = m_deltaBase->chunks.find(dset);
+    if (m_writeFull || it == m_deltaBase->chunks.end()) {
+        m_h5file.write(group, dset, m_buffer, mode);
+        // A dataset not in the base is written in full, but does not
+        // become part of the base as it is stored in a different group.
+        if (m_writeFull) {
+            if (m_deltaBase->group != group) {
+                m_deltaBase->group = group;
+                m_deltaBase->chunks.clear();
+            }
+            auto& hashes = m_deltaBase->chunks[dset];
+            hashes.clear();
+            hashes.reserve(ends.size());
+            std::size_t begin = 0;
+            for (const auto end : ends) {
+                hashes.push_back(chunkHash(m_buffer.data() + begin, end - begin));
+                begin = end;
+            }
+        }
+        return;
+    }
+
+    const auto& hashes = it->second;
+    std::unordered_map<std::uint64_t, std::int64_t> index;
+    index.reserve(hashes.size());
+    for (std::size_t i = 0; i < hashes.size(); ++i) {
+        index.emplace(hashes[i][0], i);
+    }
+
+    // Chunks found in the base are stored as their index in the base,
+    // other chunks as their negated length, with the bytes stored in order.
+    std::vector<std::int64_t> chunks;
+    std::vector<char> bytes;
+    chunks.reserve(ends.size());
+    std::size_t begin = 0;
+    for (const auto end : ends) {
+        const auto hash = chunkHash(m_buffer.data() + begin, end - begin);
+        const auto match = index.find(hash[0]);
+        if (match != index.end() && hashes[match->second] == hash) {
+            chunks.push_back(match->second);
+        } else {
+            chunks.push_back(-static_cast<std::int64_t>(end - begin));
+            bytes.insert(bytes.end(), m_buffer.begin() + begin, m_buffer.begin() + end);
+        }
+        begin = end;
+    }
+
+    const std::size_t size = m_buffer.size();
+    const auto check = chunkHash(m_buffer.data(), size);
+    try {
+        this->pack(m_deltaBase->group, size, check[0], check[1], chunks, bytes);
+    } catch (...) {
+        m_packSize = std::numeric_limits<std::size_t>::max();
+        throw;
+    }
+    m_h5file.write(group, dset + "_delta", m_buffer, mode);
+}
+
+void HDF5Serializer::readDelta(const std::string& group,
+                               const std::string& dset,
+                               HDF5File::DataSetMode mode)
+{
+    m_h5file.read(group, dset + "_delta", m_buffer, mode);
+    std::string baseGroup;
+    std::size_t size = 0;
+    std::array<std::uint64_t, 2> check{};
+    std::vector<std::int64_t> chunks;
+    std::vector<char> bytes;
+    this->unpack(baseGroup, size, check[0], check[1], chunks, bytes);
+
+    std::vector<char> base;
+    m_h5file.read(baseGroup, dset, base, mode);
+    const auto ends = chunkEnds(base);
+
+    const auto corrupt = [&group, &dset]
+    {
+        return std::runtime_error("Corrupt delta dataset " + group + '/' + dset);
+    };
+
+    m_buffer.clear();
+    m_buffer.reserve(size);
+    std::size_t pos = 0;
+    for (const auto chunk : chunks) {
+        if (chunk >= 0) {
+            const auto idx = static_cast<std::size_t>(chunk);
+            if (idx >= ends.size()) {
+                throw corrupt();
+            }
+            const std::size_t begin = idx == 0 ? 0 : ends[idx - 1];
+            m_buffer.insert(m_buffer.end(), base.begin() + begin, base.begin() + ends[idx]);
+        } else {
+            const auto len = static_cast<std::size_t>(-chunk);
+            if (pos + len > bytes.size()) {
+                throw corrupt();
+            }
+            m_buffer.insert(m_buffer.end(), bytes.begin() + pos, bytes.begin() + pos + len);
+            pos += len;
+        }
+    }
+    if (m_buffer.size() != size || chunkHash(m_buffer.data(), size) != check) {
+        throw corrupt();
+    }
+}
+
+bool HDF5Serializer::hasDelta(const std::string& group,
+                              const std::string& dset) const
+{
+    const auto entries = m_h5file.list(group);
+    return std::ranges::find(entries, dset + "_delta") != entries.end();
+}
+
 int HDF5Serializer::lastReportStep() const
 {
     const auto entries = m_h5file.list("/report_step");
@@ -27,22 +27,47 @@
 #include <opm/simulators/utils/ParallelCommunication.hpp>
 #include <opm/simulators/utils/SerializationPackers.hpp>
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
+#include <map>
 #include <string>
+#include <vector>
 
 namespace Opm {
 
+//! \brief Full datasets that later writes can be stored as differences to.
+//! \details Only the hashes of the chunks of each dataset are kept.
+struct HDF5DeltaBase {
+    std::string group; //!< Group holding the full datasets
+    //! Hashes of the chunks of the full datasets by name
+    std::map<std::string, std::vector<std::array<std::uint64_t, 2>>> chunks;
+};
+
 //! \brief Class for (de-)serializing using HDF5.
 class HDF5Serializer : public Serializer<Serialization::MemPacker> {
 public:
+    //! \brief Opens file for serialization.
+    //! \param fileName Name of file to open
+    //! \param mode Open mode for file
+    //! \param comm Parallel communicator
+    //! \param processMode Dataset mode used for process local data
+    //! \param compress True to compress written data
     HDF5Serializer(const std::string& fileName,
                    HDF5File::OpenMode mode,
-                   Parallel::Communication comm)
+                   Parallel::Communication comm,
+                   HDF5File::DataSetMode processMode = HDF5File::DataSetMode::PROCESS_SPLIT,
+                   bool compress = true)
         : Serializer<Serialization::MemPacker>(m_packer_priv)
-        , m_h5file(fileName, mode, comm)
+        , m_h5file(fileName, mode, comm, compress)
+        , m_processMode(processMode)
     {}
 
+    //! \brief Returns the dataset mode to use for process local data.
+    HDF5File::DataSetMode processMode() const
+    { return m_processMode; }
+
     //! \brief Serialize and write data to restart file.
     //! \tparam T Type of class to write
     //! \param data Class to write restart data for
@@ -62,7 +87,23 @@ public:
             throw;
         }
 
-        m_h5file.write(group, dset, m_buffer, mode);
+        if (m_deltaBase && mode != HDF5File::DataSetMode::ROOT_ONLY) {
+            writeDelta(group, dset, mode);
+        } else {
+            m_h5file.write(group, dset, m_buffer, mode);
+        }
+    }
+
+    //! \brief Enable delta writes of process local data.
+    //! \param base Base to store deltas relative to, nullptr to disable
+    //! \param full True to write full datasets and make them the new base
+    //! \details With a base set, process local datasets are written as the
+    //!          chunks not found in the same dataset in the base group.
+    //!          The base has to be kept alive while writing.
+    void setDeltaBase(HDF5DeltaBase* base, bool full)
+    {
+        m_deltaBase = base;
+        m_writeFull = full;
     }
 
     //! \brief Writes a header to the file.
@@ -91,7 +132,11 @@ public:
               const std::string& dset,
               HDF5File::DataSetMode mode = HDF5File::DataSetMode::PROCESS_SPLIT)
     {
-        m_h5file.read(group, dset, m_buffer, mode);
+        if (mode != HDF5File::DataSetMode::ROOT_ONLY && hasDelta(group, dset)) {
+            readDelta(group, dset, mode);
+        } else {
+            m_h5file.read(group, dset, m_buffer, mode);
+        }
         this->unpack(data);
     }
 
@@ -102,8 +147,27 @@ public:
     std::vector<int> reportSteps() const;
 
 private:
+    //! \brief Write the packed buffer using the delta base.
+    //! \details Writes a full dataset if requested or if there is no
+    //!          base for the dataset, otherwise the chunks not in the base.
+    void writeDelta(const std::string& group,
+                    const std::string& dset,
+                    HDF5File::DataSetMode mode);
+
+    //! \brief Read a delta dataset and the base it refers to into the buffer.
+    void readDelta(const std::string& group,
+                   const std::string& dset,
+                   HDF5File::DataSetMode mode);
+
+    //! \brief Returns true if a dataset is stored as a delta.
+    bool hasDelta(const std::string& group,
+                  const std::string& dset) const;
+
     const Serialization::MemPacker m_packer_priv{}; //!< Packer instance
     HDF5File m_h5file; //!< HDF5 backend for the serializer
+    HDF5File::DataSetMode m_processMode; //!< Dataset mode for process local data
+    HDF5DeltaBase* m_deltaBase = nullptr; //!< Base for delta writes, if any
+    bool m_writeFull = true; //!< True to write full datasets for the delta base
 };
 
 }
@@ -673,6 +673,14 @@ template<class Scalar> class WellContributions;
 
             void prepareWellsBeforeAssembling(const double dt);
 
+            /// Call func(well) for every well in the container. If threaded
+            /// well assembly is enabled, the wells that are not distributed
+            /// across processes are handled by all OpenMP threads, each with
+            /// its own deferred logger, before the distributed wells are
+            /// handled one at a time.
+            template<class Func>
+            void forEachWell_(Func&& func);
+
             void extractLegacyCellPvtRegionIndex_();
 
             void extractLegacyDepth_();
@@ -780,8 +788,14 @@ template<class Scalar> class WellContributions;
             // (and must) be mutable, as the functions using them are const.
             mutable BVector x_local_;
 
-            // Store cell rates after assembling to avoid iterating all wells and connections for every element
-            std::map<int, RateVector> cellRates_;
+            // Store cell rates after assembling to avoid iterating all wells and connections for every element.
+            // The rates are stored contiguously for the perforated cells only, with
+            // perforatedCellIndex_ giving the position of each cell in cellRates_
+            // (-1 for cells that are not perforated).
+            std::vector<RateVector> cellRates_;
+            std::vector<int> perforatedCellIndex_;
+
+            void updatePerforatedCellIndex();
 
             // Cached well solution from the system solver, consumed by
             // recoverWellSolutionAndUpdateWellState during postSolve.
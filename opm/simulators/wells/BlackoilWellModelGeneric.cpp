@@ -1312,7 +1312,7 @@ template<typename Scalar, typename IndexTraits>
 void BlackoilWellModelGeneric<Scalar, IndexTraits>::
 commitWGState()
 {
-    this->last_valid_wgstate_ = this->active_wgstate_;
+    this->last_valid_wgstate_.assign(this->active_wgstate_);
     this->genNetwork_.commitState();
 }
 
@@ -1765,7 +1765,9 @@ runWellPIScaling(const int reportStepIdx,
 
     // Minimal well setup to compute PI/II values
     {
-        auto saved_previous_wgstate = this->prevWGState();
+        // The previous state is overwritten below, so it can be moved
+        // out instead of copied.
+        auto saved_previous_wgstate = std::move(this->last_valid_wgstate_);
         this->commitWGState();
 
         this->createWellContainer(reportStepIdx);
@@ -373,7 +373,7 @@ protected:
     */
     void resetWGState()
     {
-        this->active_wgstate_ = this->last_valid_wgstate_;
+        this->active_wgstate_.assign(this->last_valid_wgstate_);
         this->genNetwork_.resetState();
         // Update helper pointers to reference the restored active state
         this->group_state_helper_.updateState(this->wellState(), this->groupState());
@@ -386,7 +386,7 @@ protected:
     */
     void updateNupcolWGState()
     {
-        this->nupcol_wgstate_ = this->active_wgstate_;
+        this->nupcol_wgstate_.assign(this->active_wgstate_);
     }
 
     void reportGroupSwitching(DeferredLogger& local_deferredLogger) const;
@@ -57,9 +57,14 @@
 #include <opm/simulators/linalg/gpubridge/WellContributions.hpp>
 #endif
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <exception>
 #include <iomanip>
 #include <optional>
 #include <utility>
@@ -175,6 +180,7 @@ namespace Opm {
         simulator_.model().addAuxiliaryModule(this);
 
         is_cell_perforated_.resize(local_num_cells_, false);
+        perforatedCellIndex_.resize(local_num_cells_, -1);
     }
 
 
@@ -411,6 +417,7 @@ namespace Opm {
             for (auto& well : well_container_) {
                 well->updatePerforatedCell(is_cell_perforated_);
             }
+            this->updatePerforatedCellIndex();
 
             // calculate the efficiency factors for each well
             this->calculateEfficiencyFactors(reportStepIdx);
@@ -739,11 +746,12 @@ namespace Opm {
     {
         rate = 0;
 
-        if (!is_cell_perforated_[elemIdx] || cellRates_.count(elemIdx) == 0) {
+        const int idx = perforatedCellIndex_[elemIdx];
+        if (idx < 0) {
             return;
         }
 
-        rate = cellRates_.at(elemIdx);
+        rate = cellRates_[idx];
     }
 
 
@@ -756,14 +764,8 @@ namespace Opm {
                             unsigned spaceIdx,
                             unsigned timeIdx) const
     {
-        rate = 0;
-        int elemIdx = context.globalSpaceIndex(spaceIdx, timeIdx);
-
-        if (!is_cell_perforated_[elemIdx] || cellRates_.count(elemIdx) == 0) {
-            return;
-        }
-
-        rate = cellRates_.at(elemIdx);
+        const unsigned elemIdx = context.globalSpaceIndex(spaceIdx, timeIdx);
+        computeTotalRatesForDof(rate, elemIdx);
     }
 
 
@@ -1374,9 +1376,10 @@ namespace Opm {
     assembleWellEq(const double dt)
     {
         OPM_TIMEFUNCTION();
-        for (auto& well : well_container_) {
-            well->assembleWellEq(simulator_, dt, this->groupStateHelper(), this->wellState());
-        }
+        forEachWell_([this, dt](auto& well)
+        {
+            well.assembleWellEq(simulator_, dt, this->groupStateHelper(), this->wellState());
+        });
     }
 
 
@@ -1386,10 +1389,67 @@ namespace Opm {
     prepareWellsBeforeAssembling(const double dt)
     {
         OPM_TIMEFUNCTION();
-        for (auto& well : well_container_) {
-            well->prepareWellBeforeAssembling(
+        forEachWell_([this, dt](auto& well)
+        {
+            well.prepareWellBeforeAssembling(
                 simulator_, dt, this->groupStateHelper(), this->wellState()
             );
+        });
+    }
+
+
+    template<typename TypeTag>
+    template<class Func>
+    void
+    BlackoilWellModel<TypeTag>::
+    forEachWell_(Func&& func)
+    {
+#ifdef _OPENMP
+        const int num_threads = omp_get_max_threads();
+        if (param_.threaded_well_assembly_ && num_threads > 1 && well_container_.size() > 1) {
+            // Distributed wells communicate with the other processes
+            // and must be handled in the same order on all of them.
+            std::vector<WellInterface<TypeTag>*> local_wells;
+            std::vector<WellInterface<TypeTag>*> distributed_wells;
+            for (auto& well : well_container_) {
+                if (well->parallelWellInfo().communication().size() > 1) {
+                    distributed_wells.push_back(well.get());
+                } else {
+                    local_wells.push_back(well.get());
+                }
+            }
+
+            std::exception_ptr failure;
+            {
+                // The static schedule gives each thread a contiguous range of
+                // wells, so merging the thread loggers keeps the well order.
+                auto thread_loggers = this->groupStateHelper().pushThreadLoggers(num_threads);
+                const int num_local = local_wells.size();
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+                for (int w = 0; w < num_local; ++w) {
+                    try {
+                        func(*local_wells[w]);
+                    }
+                    catch (...) {
+#pragma omp critical(well_model_thread_failure)
+                        if (!failure) {
+                            failure = std::current_exception();
+                        }
+                    }
+                }
+            }
+            if (failure) {
+                std::rethrow_exception(failure);
+            }
+
+            for (auto* well : distributed_wells) {
+                func(*well);
+            }
+            return;
+        }
+#endif
+        for (auto& well : well_container_) {
+            func(*well);
         }
     }
 
@@ -1405,10 +1465,11 @@ namespace Opm {
         // on one of them (WetGasPvt::saturationPressure might throw if not converged)
         OPM_BEGIN_PARALLEL_TRY_CATCH();
 
-        for (auto& well: well_container_) {
-            well->assembleWellEqWithoutIteration(simulator_, this->groupStateHelper(), dt, this->wellState(),
-                                                 /*solving_with_zero_rate=*/false);
-        }
+        forEachWell_([this, dt](auto& well)
+        {
+            well.assembleWellEqWithoutIteration(simulator_, this->groupStateHelper(), dt, this->wellState(),
+                                                /*solving_with_zero_rate=*/false);
+        });
         OPM_END_PARALLEL_TRY_CATCH_LOG(deferred_logger, "BlackoilWellModel::assembleWellEqWithoutIteration failed: ",
                                        this->terminal_output_, grid().comm());
 
@@ -1420,9 +1481,36 @@ namespace Opm {
     updateCellRates()
     {
         // Pre-compute cell rates for all wells
-        cellRates_.clear();
+        for (auto& rate : cellRates_) {
+            rate = 0.0;
+        }
+#ifdef _OPENMP
+        const int num_threads = omp_get_max_threads();
+        if (param_.threaded_well_assembly_ && num_threads > 1 && well_container_.size() > 1) {
+            // Accumulate per thread over contiguous ranges of wells, then
+            // merge in thread order to get a deterministic summation order.
+            // The per-thread buffers only cover the perforated cells.
+            std::vector<std::vector<RateVector>> thread_rates(num_threads);
+            const int num_wells = well_container_.size();
+#pragma omp parallel num_threads(num_threads)
+            {
+                auto& rates = thread_rates[omp_get_thread_num()];
+                rates.assign(cellRates_.size(), RateVector(0.0));
+#pragma omp for schedule(static)
+                for (int w = 0; w < num_wells; ++w) {
+                    well_container_[w]->addCellRates(rates, perforatedCellIndex_);
+                }
+            }
+            for (const auto& rates : thread_rates) {
+                for (std::size_t idx = 0; idx < rates.size(); ++idx) {
+                    cellRates_[idx] += rates[idx];
+                }
+            }
+            return;
+        }
+#endif
         for (const auto& well : well_container_) {
-            well->addCellRates(cellRates_);
+            well->addCellRates(cellRates_, perforatedCellIndex_);
         }
     }
 
@@ -1432,13 +1520,32 @@ namespace Opm {
     updateCellRatesForDomain(int domainIndex, const std::map<std::string, int>& well_domain_map)
     {
         // Pre-compute cell rates only for wells in the specified domain
-        cellRates_.clear();
+        for (auto& rate : cellRates_) {
+            rate = 0.0;
+        }
         for (const auto& well : well_container_) {
             const auto it = well_domain_map.find(well->name());
             if (it != well_domain_map.end() && it->second == domainIndex) {
-                well->addCellRates(cellRates_);
+                well->addCellRates(cellRates_, perforatedCellIndex_);
+            }
+        }
+    }
+
+    template<typename TypeTag>
+    void
+    BlackoilWellModel<TypeTag>::
+    updatePerforatedCellIndex()
+    {
+        // Number the perforated cells in cell order, so that the rates of
+        // neighbouring cells are also neighbours in cellRates_.
+        perforatedCellIndex_.assign(is_cell_perforated_.size(), -1);
+        int num_perforated = 0;
+        for (std::size_t cell = 0; cell < is_cell_perforated_.size(); ++cell) {
+            if (is_cell_perforated_[cell]) {
+                perforatedCellIndex_[cell] = num_perforated++;
             }
         }
+        cellRates_.assign(num_perforated, RateVector(0.0));
     }
 
 #if COMPILE_GPU_BRIDGE
@@ -1581,7 +1688,18 @@ namespace Opm {
     {
         auto loggerGuard = this->groupStateHelper().pushLogger();
         OPM_BEGIN_PARALLEL_TRY_CATCH();
-        {
+        if (param_.threaded_well_assembly_) {
+            forEachWell_([this, &x](auto& well)
+            {
+                const auto& cells = well.cells();
+                BVector x_local(cells.size());
+                for (std::size_t i = 0; i < cells.size(); ++i) {
+                    x_local[i] = x[cells[i]];
+                }
+                well.recoverWellSolutionAndUpdateWellState(simulator_, x_local,
+                                                           this->groupStateHelper(), this->wellState());
+            });
+        } else {
             for (const auto& well : well_container_) {
                 const auto& cells = well->cells();
                 x_local_.resize(cells.size());
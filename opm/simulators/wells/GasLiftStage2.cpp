@@ -36,7 +36,10 @@
 #include <opm/simulators/wells/GasLiftGroupInfo.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
+#include <iterator>
+#include <numeric>
 #include <optional>
 #include <string>
 
@@ -370,6 +373,32 @@ mpiSyncGlobalGradVector_(std::vector<GradPair>& grads_global) const
     mpiSyncLocalToGlobalGradVector_(grads_local, grads_global);
 }
 
+// Same as calling mpiSyncGlobalGradVector_() for both vectors, but with
+//   a single exchange between the ranks
+template<typename Scalar, typename IndexTraits>
+void GasLiftStage2<Scalar, IndexTraits>::
+mpiSyncGlobalGradVectors_(std::vector<GradPair>& dec_grads_global,
+                          std::vector<GradPair>& inc_grads_global) const
+{
+    if (this->comm_.size() == 1)
+        return;
+
+    auto local_grads = [this](const std::vector<GradPair>& grads_global)
+    {
+        std::vector<GradPair> grads_local;
+        for (const auto& grad : grads_global) {
+            if (this->well_state_map_.count(grad.first) > 0) {
+                grads_local.push_back(grad);
+            }
+        }
+        return grads_local;
+    };
+    const auto dec_grads_local = local_grads(dec_grads_global);
+    const auto inc_grads_local = local_grads(inc_grads_global);
+    mpiSyncLocalToGlobalGradVectors_(dec_grads_local, inc_grads_local,
+                                     dec_grads_global, inc_grads_global);
+}
+
 template<typename Scalar, typename IndexTraits>
 void GasLiftStage2<Scalar, IndexTraits>::
 mpiSyncLocalToGlobalGradVector_(const std::vector<GradPair>& grads_local,
@@ -410,6 +439,62 @@ mpiSyncLocalToGlobalGradVector_(const std::vector<GradPair>& grads_local,
     }
 }
 
+// The decremental and incremental gradients are gathered in one
+//   collective call. Each rank sends its owned decremental gradients
+//   followed by its owned incremental gradients.
+template<typename Scalar, typename IndexTraits>
+void GasLiftStage2<Scalar, IndexTraits>::
+mpiSyncLocalToGlobalGradVectors_(const std::vector<GradPair>& dec_grads_local,
+                                 const std::vector<GradPair>& inc_grads_local,
+                                 std::vector<GradPair>& dec_grads_global,
+                                 std::vector<GradPair>& inc_grads_global) const
+{
+    assert(this->comm_.size() > 1);  // The parent should check if comm. size is > 1
+    using Pair = std::pair<int, double>;
+    std::vector<Pair> grads_local_tmp;
+    grads_local_tmp.reserve(dec_grads_local.size() + inc_grads_local.size());
+    auto add_owned = [this, &grads_local_tmp](const std::vector<GradPair>& grads_local)
+    {
+        for (const auto& [name, grad] : grads_local) {
+            if (!this->well_state_.wellIsOwned(name))
+                continue;
+            grads_local_tmp.emplace_back(this->well_state_.wellNameToGlobalIdx(name), grad);
+        }
+    };
+    add_owned(dec_grads_local);
+    const int num_dec = static_cast<int>(grads_local_tmp.size());
+    add_owned(inc_grads_local);
+
+    const int nranks = this->comm_.size();
+    const std::array<int, 2> my_sizes{num_dec, static_cast<int>(grads_local_tmp.size()) - num_dec};
+    std::vector<int> split_sizes(2 * nranks);
+    this->comm_.allgather(my_sizes.data(), 2, split_sizes.data());
+    std::vector<int> sizes_(nranks);
+    for (int rank = 0; rank < nranks; ++rank) {
+        sizes_[rank] = split_sizes[2 * rank] + split_sizes[2 * rank + 1];
+    }
+    std::vector<int> displ_(nranks + 1, 0);
+    std::partial_sum(sizes_.begin(), sizes_.end(), displ_.begin()+1);
+    std::vector<Pair> grads_global_tmp(displ_.back());
+
+    this->comm_.allgatherv(grads_local_tmp.data(), grads_local_tmp.size(),
+        grads_global_tmp.data(), sizes_.data(), displ_.data());
+
+    // NOTE: This leaves the capacity of the global vectors unchanged, so
+    //   memory is not reallocated here
+    dec_grads_global.clear();
+    inc_grads_global.clear();
+    for (int rank = 0; rank < nranks; ++rank) {
+        const int inc_begin = displ_[rank] + split_sizes[2 * rank];
+        for (int i = displ_[rank]; i < displ_[rank + 1]; ++i) {
+            auto& grads_global = i < inc_begin ? dec_grads_global : inc_grads_global;
+            grads_global.emplace_back(
+                this->well_state_.globalIdxToWellName(grads_global_tmp[i].first),
+                grads_global_tmp[i].second);
+        }
+    }
+}
+
 template<typename Scalar, typename IndexTraits>
 void GasLiftStage2<Scalar, IndexTraits>::
 optimizeGroup_(const Group& group)
@@ -590,8 +675,8 @@ redistributeALQ_(std::vector<GasLiftSingleWell*>& wells,
         dec_grads_local.reserve(wells.size());
         state.calculateEcoGradients(wells, inc_grads_local, dec_grads_local);
         // the gradients needs to be communicated to all ranks
-        mpiSyncLocalToGlobalGradVector_(dec_grads_local, dec_grads);
-        mpiSyncLocalToGlobalGradVector_(inc_grads_local, inc_grads);
+        mpiSyncLocalToGlobalGradVectors_(dec_grads_local, inc_grads_local,
+                                         dec_grads, inc_grads);
     }
 
     if (!state.checkAtLeastTwoWells(wells)) {
@@ -763,7 +848,35 @@ template<typename Scalar, typename IndexTraits>
 void GasLiftStage2<Scalar, IndexTraits>::
 sortGradients_(std::vector<GradPair>& grads)
 {
-    std::ranges::sort(grads, {}, &GradPair::second);
+    // Between two iterations of the optimization only the gradients of the
+    //   wells that received or gave away an ALQ increment change, and after
+    //   the parallel synchronization the vector is a concatenation of the
+    //   sorted vectors of each process. In both cases the vector consists of
+    //   a few sorted runs, which are merged instead of sorting the whole
+    //   vector.
+    constexpr std::size_t max_runs = 8;
+    const auto less = [](const GradPair& a, const GradPair& b)
+                      { return a.second < b.second; };
+    std::vector<std::size_t> run_ends;
+    for (std::size_t i = 1; i < grads.size() && run_ends.size() < max_runs; ++i) {
+        if (less(grads[i], grads[i - 1])) {
+            run_ends.push_back(i);
+        }
+    }
+    if (run_ends.empty()) {
+        return;
+    }
+    if (run_ends.size() >= max_runs) {
+        std::ranges::stable_sort(grads, less);
+        return;
+    }
+    run_ends.push_back(grads.size());
+    for (std::size_t r = 1; r < run_ends.size(); ++r) {
+        std::inplace_merge(grads.begin(),
+                           grads.begin() + run_ends[r - 1],
+                           grads.begin() + run_ends[r],
+                           less);
+    }
 }
 
 template<typename Scalar, typename IndexTraits>
@@ -965,8 +1078,7 @@ recalculateGradients(std::vector<GradPair>& inc_grads,
         min_dec_grad_itr, this->group.name(), /*increase=*/false, dec_grads, inc_grads);
 
     // The dec_grads and inc_grads needs to be syncronized across ranks
-    this->parent.mpiSyncGlobalGradVector_(dec_grads);
-    this->parent.mpiSyncGlobalGradVector_(inc_grads);
+    this->parent.mpiSyncGlobalGradVectors_(dec_grads, inc_grads);
 }
 
 // Take one ALQ increment from well1, and give it to well2
@@ -136,8 +136,14 @@ protected:
                            Scalar grad);
 
     void mpiSyncGlobalGradVector_(std::vector<GradPair>& grads_global) const;
+    void mpiSyncGlobalGradVectors_(std::vector<GradPair>& dec_grads_global,
+                                   std::vector<GradPair>& inc_grads_global) const;
     void mpiSyncLocalToGlobalGradVector_(const std::vector<GradPair>& grads_local,
                                          std::vector<GradPair>& grads_global) const;
+    void mpiSyncLocalToGlobalGradVectors_(const std::vector<GradPair>& dec_grads_local,
+                                          const std::vector<GradPair>& inc_grads_local,
+                                          std::vector<GradPair>& dec_grads_global,
+                                          std::vector<GradPair>& inc_grads_global) const;
 
     std::array<Scalar, 4> computeDelta(const std::string& name, bool add);
     void updateGroupInfo(const std::string& name, bool add);
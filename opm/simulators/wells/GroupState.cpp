@@ -26,6 +26,7 @@
 #include <opm/json/JsonObject.hpp>
 #include <opm/input/eclipse/Schedule/Group/GConSump.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/simulators/utils/AssignMapValues.hpp>
 #include <opm/simulators/wells/GroupState.hpp>
 
 
@@ -85,6 +86,34 @@ bool GroupState<Scalar>::operator==(const GroupState& other) const
 
 //-------------------------------------------------------------------------
 
+template<class Scalar>
+void GroupState<Scalar>::assign(const GroupState& other)
+{
+    this->num_phases = other.num_phases;
+    assignMapValues(this->m_production_rates, other.m_production_rates);
+    assignMapValues(this->m_network_leaf_node_injection_rates, other.m_network_leaf_node_injection_rates);
+    assignMapValues(this->m_network_leaf_node_production_rates, other.m_network_leaf_node_production_rates);
+    this->production_controls = other.production_controls;
+    assignMapValues(this->m_prev_production_rates, other.m_prev_production_rates);
+    assignMapValues(this->prod_red_rates, other.prod_red_rates);
+    assignMapValues(this->inj_red_rates, other.inj_red_rates);
+    assignMapValues(this->inj_surface_rates, other.inj_surface_rates);
+    assignMapValues(this->inj_resv_rates, other.inj_resv_rates);
+    assignMapValues(this->inj_rein_rates, other.inj_rein_rates);
+    this->inj_vrep_rate = other.inj_vrep_rate;
+    this->m_grat_sales_target = other.m_grat_sales_target;
+    this->m_gpmaint_target = other.m_gpmaint_target;
+    this->group_thp = other.group_thp;
+    this->production_group_potentials = other.production_group_potentials;
+    this->m_number_of_wells_under_group_control = other.m_number_of_wells_under_group_control;
+    this->m_number_of_wells_under_inj_group_control = other.m_number_of_wells_under_inj_group_control;
+    this->injection_controls = other.injection_controls;
+    this->gpmaint_state = other.gpmaint_state;
+    this->m_gconsump_rates = other.m_gconsump_rates;
+}
+
+//-------------------------------------------------------------------------
+
 template<class Scalar>
 bool GroupState<Scalar>::has_production_rates(const std::string& gname) const
 {
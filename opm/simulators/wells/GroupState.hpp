@@ -47,6 +47,12 @@ public:
 
     bool operator==(const GroupState& other) const;
 
+    /// Copy the state of other into this object. Unlike the copy
+    /// assignment operator this keeps the storage of the per group rate
+    /// vectors when both states hold the same groups. Copies each
+    /// member, so it must be updated when members are added.
+    void assign(const GroupState& other);
+
     bool has_production_rates(const std::string& gname) const;
     void update_production_rates(const std::string& gname,
                                  const std::vector<Scalar>& rates);
@@ -239,6 +245,8 @@ public:
     }
 
 private:
+    // Remember to update assign(), operator==() and serializeOp() when
+    // adding members.
     std::size_t num_phases{};
     std::map<std::string, std::vector<Scalar>> m_production_rates;
     std::map<std::string, std::vector<Scalar>> m_network_leaf_node_injection_rates;
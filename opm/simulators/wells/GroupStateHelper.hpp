@@ -40,6 +40,10 @@
 
 #include <opm/simulators/utils/ParallelCommunication.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <algorithm>
 #include <map>
 #include <memory>
@@ -193,6 +197,53 @@ public:
         bool do_mpi_gather_{true};         // Whether to gather messages across MPI ranks
     };
 
+    /// @brief RAII guard that gives each OpenMP thread its own DeferredLogger
+    ///
+    /// @details While the guard is alive, deferredLogger() called from inside an
+    /// OpenMP parallel region returns the logger of the calling thread. On
+    /// destruction the thread loggers are appended, in thread order, to the
+    /// logger that was current when the guard was created. With a static loop
+    /// schedule this gives the same message order as a serial loop.
+    ///
+    /// Usage:
+    ///   auto guard = groupStateHelper.pushThreadLoggers(num_threads);
+    ///   #pragma omp parallel for num_threads(num_threads) schedule(static)
+    ///   // Use groupStateHelper.deferredLogger() to log messages
+    class ThreadLoggersGuard
+    {
+    public:
+        ThreadLoggersGuard(const GroupStateHelper& helper, const int num_threads)
+            : helper_(helper)
+            , loggers_(num_threads)
+        {
+            // The thread messages are merged into the current logger
+            if (helper_.deferred_logger_ == nullptr) {
+                throw std::logic_error("DeferredLogger not set. Call pushLogger() "
+                                       "before pushThreadLoggers().");
+            }
+            target_ = helper_.deferred_logger_;
+            helper_.thread_loggers_ = &loggers_;
+        }
+
+        ~ThreadLoggersGuard()
+        {
+            helper_.thread_loggers_ = nullptr;
+            for (const auto& logger : loggers_) {
+                target_->append(logger);
+            }
+        }
+
+        ThreadLoggersGuard(const ThreadLoggersGuard&) = delete;
+        ThreadLoggersGuard& operator=(const ThreadLoggersGuard&) = delete;
+        ThreadLoggersGuard(ThreadLoggersGuard&&) = delete;
+        ThreadLoggersGuard& operator=(ThreadLoggersGuard&&) = delete;
+
+    private:
+        const GroupStateHelper& helper_;
+        std::vector<DeferredLogger> loggers_; // One logger per thread
+        DeferredLogger* target_{nullptr};     // Logger current at creation
+    };
+
     using GroupTarget = typename SingleWellState<Scalar, IndexTraits>::GroupTarget;
 
     GroupStateHelper(WellState<Scalar, IndexTraits>& well_state,
@@ -232,6 +283,11 @@ public:
     /// @throws std::logic_error if no logger has been set via pushLogger()
     DeferredLogger& deferredLogger() const
     {
+#ifdef _OPENMP
+        if (this->thread_loggers_ != nullptr && omp_in_parallel()) {
+            return (*this->thread_loggers_)[omp_get_thread_num()];
+        }
+#endif
         if (this->deferred_logger_ == nullptr) {
             throw std::logic_error("DeferredLogger not set. Call pushLogger() first.");
         }
@@ -365,6 +421,15 @@ public:
         return ScopedLoggerGuard(*this, do_mpi_gather);
     }
 
+    /// @brief Give each thread of a following OpenMP loop its own logger
+    ///
+    /// @param num_threads The number of threads of the parallel loop
+    /// @return RAII guard that owns the thread loggers and merges them on destruction
+    ThreadLoggersGuard pushThreadLoggers(const int num_threads) const
+    {
+        return ThreadLoggersGuard(*this, num_threads);
+    }
+
     WellStateGuard pushWellState(WellState<Scalar, IndexTraits>& well_state)
     {
         return WellStateGuard(*this, well_state);
@@ -750,6 +815,8 @@ private:
     // NOTE: The deferred logger does not change the object "meaningful" state, so it should be ok to
     //   make it mutable and store a pointer to it here.
     mutable DeferredLogger* deferred_logger_ {nullptr};
+    // Loggers used by the threads of a parallel loop over wells, see ThreadLoggersGuard.
+    mutable std::vector<DeferredLogger>* thread_loggers_ {nullptr};
     // NOTE: The phase usage info seems to be read-only throughout the simulation, so it should be safe
     // to store a reference to it here.
     const PhaseUsageInfo<IndexTraits>& phase_usage_info_;
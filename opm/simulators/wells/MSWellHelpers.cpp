@@ -38,6 +38,9 @@
 
 #include <opm/simulators/wells/ParallelWellInfo.hpp>
 
+#include <dune/common/fmatrix.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
 #include <dune/istl/preconditioners.hh>
 #include <dune/istl/solvers.hh>
 
@@ -45,8 +48,11 @@
 #include <dune/istl/umfpack.hh>
 #endif // HAVE_SUITESPARSE_UMFPACK
 
+#include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <stdexcept>
+#include <utility>
 
 namespace {
 
@@ -148,6 +154,152 @@ mmv (const X& x, Y& y) const
     }
 }
 
+template<class MatrixType, class VectorType>
+void SegmentTreeSolver<MatrixType, VectorType>::
+analyse(const std::vector<int>& outlets)
+{
+    const int num_seg = outlets.size();
+    outlets_ = outlets;
+    factorized_ = false;
+
+    std::vector<std::vector<int>> inlets(num_seg);
+    std::vector<int> roots;
+    for (int seg = 0; seg < num_seg; ++seg) {
+        if (outlets[seg] < 0) {
+            roots.push_back(seg);
+        } else {
+            inlets[outlets[seg]].push_back(seg);
+        }
+    }
+
+    // Post-order traversal from the top segment(s), giving an order where
+    // all inlets of a segment come before the segment itself.
+    order_.clear();
+    order_.reserve(num_seg);
+    std::vector<std::pair<int, std::size_t>> stack;
+    for (const int root : roots) {
+        stack.emplace_back(root, 0);
+        while (!stack.empty()) {
+            auto& [seg, next] = stack.back();
+            if (next < inlets[seg].size()) {
+                stack.emplace_back(inlets[seg][next++], 0);
+            } else {
+                order_.push_back(seg);
+                stack.pop_back();
+            }
+        }
+    }
+
+    if (static_cast<int>(order_.size()) != num_seg) {
+        OPM_THROW(std::logic_error, "Segment outlets do not form a tree");
+    }
+
+    invDiag_.resize(num_seg);
+    lower_.resize(num_seg);
+    upper_.resize(num_seg);
+}
+
+template<class MatrixType, class VectorType>
+bool SegmentTreeSolver<MatrixType, VectorType>::
+factorize(const MatrixType& D)
+{
+    factorized_ = false;
+    for (const int seg : order_) {
+        // The inlets of seg are already eliminated, and have added their
+        // contributions to lower_ and upper_ of seg.
+        Block diag = D[seg][seg];
+        const auto& row = D[seg];
+        for (auto col = row.begin(); col != row.end(); ++col) {
+            const int inlet = col.index();
+            if (inlet == seg || inlet == outlets_[seg]) {
+                continue;
+            }
+            // diag -= D(seg, inlet) * inv(S(inlet)) * D(inlet, seg)
+            Block update = lower_[inlet];
+            update.rightmultiply(upper_[inlet]);
+            diag -= update;
+        }
+
+        try {
+            diag.invert();
+        } catch (const Dune::FMatrixError&) {
+            return false;
+        }
+        for (const auto& r : diag) {
+            for (const auto& v : r) {
+                if (!std::isfinite(v)) {
+                    return false;
+                }
+            }
+        }
+        invDiag_[seg] = diag;
+
+        const int outlet = outlets_[seg];
+        if (outlet >= 0) {
+            lower_[seg] = D[outlet][seg];
+            lower_[seg].rightmultiply(invDiag_[seg]);
+            upper_[seg] = D[seg][outlet];
+        }
+    }
+    factorized_ = true;
+    return true;
+}
+
+template<class MatrixType, class VectorType>
+VectorType SegmentTreeSolver<MatrixType, VectorType>::
+solve(const VectorType& rhs) const
+{
+    assert(factorized_);
+
+    // Forward elimination from the inlets towards the top segment.
+    VectorType y = rhs;
+    for (const int seg : order_) {
+        const int outlet = outlets_[seg];
+        if (outlet >= 0) {
+            lower_[seg].mmv(y[seg], y[outlet]);
+        }
+    }
+
+    // Back substitution from the top segment.
+    VectorType x(rhs.size());
+    for (auto it = order_.rbegin(); it != order_.rend(); ++it) {
+        const int seg = *it;
+        const int outlet = outlets_[seg];
+        if (outlet >= 0) {
+            upper_[seg].mmv(x[outlet], y[seg]);
+        }
+        invDiag_[seg].mv(y[seg], x[seg]);
+    }
+    return x;
+}
+
+template<class MatrixType, class VectorType>
+Dune::Matrix<typename SegmentTreeSolver<MatrixType, VectorType>::Block>
+SegmentTreeSolver<MatrixType, VectorType>::
+inverse() const
+{
+    const int size = order_.size();
+    const int bsize = Block::rows;
+    VectorType e(size);
+    e = 0.0;
+
+    // Create inverse by passing basis vectors to the solver.
+    Dune::Matrix<Block> inv(size, size);
+    for (int ii = 0; ii < size; ++ii) {
+        for (int jj = 0; jj < bsize; ++jj) {
+            e[ii][jj] = 1.0;
+            const auto col = solve(e);
+            for (int cc = 0; cc < size; ++cc) {
+                for (int dd = 0; dd < bsize; ++dd) {
+                    inv[cc][ii][dd][jj] = col[cc][dd];
+                }
+            }
+            e[ii][jj] = 0.0;
+        }
+    }
+    return inv;
+}
+
     /// Applies umfpack and checks for singularity
 template <typename MatrixType, typename VectorType>
 VectorType
@@ -381,6 +533,7 @@ using Mat = Dune::BCRSMatrix<Dune::FieldMatrix<Scalar,M,N>>;
     INSTANTIATE_PARALLELLMSWELLB(T, 5, 5)
 
 #define INSTANTIATE_UMF(T,Dim)                                             \
+    template class SegmentTreeSolver<Mat<T,Dim>, Vec<T,Dim>>;              \
     template Vec<T,Dim> applyUMFPack(Dune::UMFPack<Mat<T,Dim>>&,           \
                                      Vec<T,Dim>);                          \
     template Dune::Matrix<typename Mat<T,Dim>::block_type>                 \
@@ -25,6 +25,8 @@
 
 #include <dune/istl/matrix.hh>
 
+#include <vector>
+
 namespace Dune {
 template<class Matrix> class UMFPack;
 }
@@ -70,6 +72,57 @@ namespace mswellhelpers
         const ParallelWellInfo<Scalar>& parallel_well_info_;
     };
 
+    /// \brief Direct solver for the segment matrix D of a multisegment well.
+    ///
+    /// The off-diagonal entries of D couple each segment to its outlet and
+    /// its inlets only, so the sparsity pattern of D is a tree. Eliminating
+    /// the inlets before their outlets gives a block LU factorization
+    /// without fill-in, which for an unbranched well reduces to the block
+    /// tridiagonal (Thomas) algorithm.
+    ///
+    /// The elimination order only depends on the segment structure, and is
+    /// computed once by analyse(). Each Newton iteration then only needs
+    /// the numeric factorization in factorize().
+    ///
+    /// \tparam MatrixType The BCRS matrix type of D.
+    /// \tparam VectorType The block vector type of the well residual.
+    template<class MatrixType, class VectorType>
+    class SegmentTreeSolver
+    {
+    public:
+        using Block = typename MatrixType::block_type;
+
+        /// \brief Set up the elimination order.
+        /// \param outlets Index of the outlet segment of each segment,
+        ///                negative for the top segment.
+        void analyse(const std::vector<int>& outlets);
+
+        /// \brief Compute the block LU factorization of D.
+        /// \return False if a diagonal block is singular. The solver is then
+        ///         not usable, and a pivoting solver must be used instead.
+        bool factorize(const MatrixType& D);
+
+        /// \brief Whether factorize() succeeded since the last clear().
+        bool isFactorized() const { return factorized_; }
+
+        /// \brief Invalidate the factorization, keeping the elimination order.
+        void clear() { factorized_ = false; }
+
+        /// \brief Return D^-1 * rhs.
+        VectorType solve(const VectorType& rhs) const;
+
+        /// \brief Return D^-1 as a full block matrix.
+        Dune::Matrix<Block> inverse() const;
+
+    private:
+        std::vector<int> outlets_; //!< Outlet of each segment, -1 for the top
+        std::vector<int> order_;   //!< Segments with the inlets before their outlet
+        std::vector<Block> invDiag_; //!< Inverse of the eliminated diagonal blocks
+        std::vector<Block> lower_; //!< D(outlet, seg) * invDiag_(seg)
+        std::vector<Block> upper_; //!< D(seg, outlet)
+        bool factorized_ = false;
+    };
+
     /// Applies umfpack and checks for singularity
     template <typename MatrixType, typename VectorType>
     VectorType
@@ -85,6 +85,9 @@ init(const int numPerfs,
     duneB_.setSize(well_.numberOfSegments(), numPerfs, numPerfs);
     duneC_.setSize(well_.numberOfSegments(), numPerfs, numPerfs);
 
+    // outlet of each segment, used for the elimination order of treeSolver_
+    std::vector<int> outlets(well_.numberOfSegments(), -1);
+
     // we need to add the off diagonal ones
     auto endD = duneD_.createend();
     for (auto row = duneD_.createbegin(); row != endD; ++row) {
@@ -96,6 +99,7 @@ init(const int numPerfs,
         if (outlet_segment_number > 0) { // if there is a outlet_segment
             const int outlet_segment_index = well_.segmentNumberToIndex(outlet_segment_number);
             row.insert(outlet_segment_index);
+            outlets[seg] = outlet_segment_index;
         }
 
         // Add nonzeros for diagonal
@@ -133,6 +137,8 @@ init(const int numPerfs,
 
     resWell_.resize(well_.numberOfSegments());
 
+    treeSolver_.analyse(outlets);
+
     // Store the global index of well perforated cells
     cells_ = cells;
 }
@@ -147,6 +153,7 @@ void MultisegmentWellEquations<Scalar, IndexTraits, numWellEq, numEq>::clear()
     if constexpr (std::is_same_v<Scalar,double>) {
         duneDSolver_.reset();
     }
+    treeSolver_.clear();
 }
 
 template<class Scalar, typename IndexTraits, int numWellEq, int numEq>
@@ -161,14 +168,12 @@ apply(const BVector& x, BVector& Ax) const
     // because the other processes would remain idle while waiting for
     // the single process to complete the computation.
     // invDBx = duneD^-1 * Bx_
-    if constexpr (std::is_same_v<Scalar,double>) {
-        const BVectorWell invDBx = mswellhelpers::applyUMFPack(*duneDSolver_, Bx);
-        // Ax.size() == 0 indicates that there are no active perforations on this process.
-        // Then, Ax does not need to be updated by the following calculation.
-        if (Ax.size() > 0) {
-            // Ax = Ax - duneC_^T * invDBx
-            duneC_.mmtv(invDBx,Ax);
-        }
+    const BVectorWell invDBx = solveD(Bx);
+    // Ax.size() == 0 indicates that there are no active perforations on this process.
+    // Then, Ax does not need to be updated by the following calculation.
+    if (Ax.size() > 0) {
+        // Ax = Ax - duneC_^T * invDBx
+        duneC_.mmtv(invDBx,Ax);
     }
 }
 
@@ -176,24 +181,29 @@ template<class Scalar, typename IndexTraits, int numWellEq, int numEq>
 void MultisegmentWellEquations<Scalar, IndexTraits, numWellEq, numEq>::
 apply(BVector& r) const
 {
-    if constexpr (std::is_same_v<Scalar,double>) {
-        // r.size() == 0 indicates that there are no active perforations on this process.
-        // Then, r does not need to be updated by the following calculation.
-        if (r.size() > 0) {
-            // It is ok to do this on each process instead of only on one,
-            // because the other processes would remain idle while waiting for
-            // the single process to complete the computation.
-            // invDrw_ = duneD^-1 * resWell_
-            const BVectorWell invDrw = mswellhelpers::applyUMFPack(*duneDSolver_, resWell_);
-            // r = r - duneC_^T * invDrw
-            duneC_.mmtv(invDrw, r);
-        }
+    // r.size() == 0 indicates that there are no active perforations on this process.
+    // Then, r does not need to be updated by the following calculation.
+    if (r.size() > 0) {
+        // It is ok to do this on each process instead of only on one,
+        // because the other processes would remain idle while waiting for
+        // the single process to complete the computation.
+        // invDrw_ = duneD^-1 * resWell_
+        const BVectorWell invDrw = solveD(resWell_);
+        // r = r - duneC_^T * invDrw
+        duneC_.mmtv(invDrw, r);
     }
 }
 
 template<class Scalar, typename IndexTraits, int numWellEq, int numEq>
-void MultisegmentWellEquations<Scalar, IndexTraits, numWellEq, numEq>::createSolver()
+void MultisegmentWellEquations<Scalar, IndexTraits, numWellEq, numEq>::
+createSolver(const bool useTreeSolver)
 {
+    if (useTreeSolver) {
+        if (treeSolver_.isFactorized() || treeSolver_.factorize(duneD_)) {
+            return;
+        }
+        // A singular diagonal block needs the pivoting of UMFPack.
+    }
 #if HAVE_SUITESPARSE_UMFPACK
     if constexpr (std::is_same_v<Scalar,float>) {
         OPM_THROW(std::runtime_error, "MultisegmentWell support requires UMFPACK, "
@@ -214,25 +224,30 @@ template<class Scalar, typename IndexTraits, int numWellEq, int numEq>
 typename MultisegmentWellEquations<Scalar, IndexTraits, numWellEq, numEq>::BVectorWell
 MultisegmentWellEquations<Scalar, IndexTraits, numWellEq, numEq>::solve() const
 {
-    if constexpr (std::is_same_v<Scalar,double>) {
-        // It is ok to do this on each process instead of only on one,
-        // because the other processes would remain idle while waiting for
-        // the single process to complete the computation.
-        return mswellhelpers::applyUMFPack(*duneDSolver_, resWell_);
-    }
-    else {
-       return {};
-    }
+    // It is ok to do this on each process instead of only on one,
+    // because the other processes would remain idle while waiting for
+    // the single process to complete the computation.
+    return solveD(resWell_);
 }
 
 template<class Scalar, typename IndexTraits, int numWellEq, int numEq>
 typename MultisegmentWellEquations<Scalar, IndexTraits, numWellEq, numEq>::BVectorWell
 MultisegmentWellEquations<Scalar, IndexTraits, numWellEq, numEq>::solve(const BVectorWell& rhs) const
 {
+    // It is ok to do this on each process instead of only on one,
+    // because the other processes would remain idle while waiting for
+    // the single process to complete the computation.
+    return solveD(rhs);
+}
+
+template<class Scalar, typename IndexTraits, int numWellEq, int numEq>
+typename MultisegmentWellEquations<Scalar, IndexTraits, numWellEq, numEq>::BVectorWell
+MultisegmentWellEquations<Scalar, IndexTraits, numWellEq, numEq>::solveD(const BVectorWell& rhs) const
+{
+    if (treeSolver_.isFactorized()) {
+        return treeSolver_.solve(rhs);
+    }
     if constexpr (std::is_same_v<Scalar,double>) {
-        // It is ok to do this on each process instead of only on one,
-        // because the other processes would remain idle while waiting for
-        // the single process to complete the computation.
         return mswellhelpers::applyUMFPack(*duneDSolver_, rhs);
     }
     else {
@@ -244,17 +259,15 @@ template<class Scalar, typename IndexTraits, int numWellEq, int numEq>
 void MultisegmentWellEquations<Scalar, IndexTraits, numWellEq, numEq>::
 recoverSolutionWell(const BVector& x, BVectorWell& xw) const
 {
-    if constexpr (std::is_same_v<Scalar,double>) {
-        BVectorWell resWell = resWell_;
-        // resWell = resWell - B * x
-        parallelB_.mmv(x, resWell);
+    BVectorWell resWell = resWell_;
+    // resWell = resWell - B * x
+    parallelB_.mmv(x, resWell);
 
-        // xw = D^-1 * resWell
-        // It is ok to do this on each process instead of only on one,
-        // because the other processes would remain idle while waiting for
-        // the single process to complete the computation.
-        xw = mswellhelpers::applyUMFPack(*duneDSolver_, resWell);
-    }
+    // xw = D^-1 * resWell
+    // It is ok to do this on each process instead of only on one,
+    // because the other processes would remain idle while waiting for
+    // the single process to complete the computation.
+    xw = solveD(resWell);
 }
 
 #if COMPILE_GPU_BRIDGE
@@ -333,9 +346,11 @@ void MultisegmentWellEquations<Scalar, IndexTraits, numWellEq, numEq>::
 extract(SparseMatrixAdapter& jacobian) const
 {
     if constexpr (std::is_same_v<Scalar,double>) {
-        const auto invDuneD = mswellhelpers::invertWithUMFPack<BVectorWell>(duneD_.M(),
-                                                                            numWellEq,
-                                                                            *duneDSolver_);
+        const auto invDuneD = treeSolver_.isFactorized()
+            ? treeSolver_.inverse()
+            : mswellhelpers::invertWithUMFPack<BVectorWell>(duneD_.M(),
+                                                            numWellEq,
+                                                            *duneDSolver_);
 
         // We need to change matrix A as follows
         // A -= C^T D^-1 B
@@ -95,7 +95,9 @@ public:
     void apply(BVector& r) const;
 
     //! \brief Compute the LU-decomposition of D matrix.
-    void createSolver();
+    //! \param useTreeSolver Use the block elimination along the segment
+    //!                      tree instead of UMFPack when possible.
+    void createSolver(const bool useTreeSolver);
 
     //! \brief Apply inverted D matrix to residual and return result.
     BVectorWell solve() const;
@@ -157,6 +159,15 @@ private:
                                              EmptyType>; // TODO: c++20: add no_unique_address
     mutable UMFPackSolver duneDSolver_;
 
+    /// \brief Block elimination solver for D following the segment tree.
+    ///
+    /// The elimination order is set up in init(), and only the numeric
+    /// factorization is redone in createSolver().
+    mswellhelpers::SegmentTreeSolver<DiagMatWell, BVectorWell> treeSolver_;
+
+    //! \brief Apply inverted D matrix to rhs, using the solver set up in createSolver().
+    BVectorWell solveD(const BVectorWell& rhs) const;
+
     // residuals of the well equations
     BVectorWell resWell_;
 
@@ -2103,7 +2103,7 @@ namespace Opm
         }
 
         this->parallel_well_info_.communication().sum(this->ipr_a_.data(), this->ipr_a_.size());
-        this->linSys_.createSolver();
+        this->linSys_.createSolver(this->param_.use_tree_solver_ms_wells_);
     }
 
 
@@ -68,25 +68,29 @@ namespace RateConverter {
 
 template <class FluidSystem, class Region>
 void SurfaceToReservoirVoidage<FluidSystem, Region>::
-sumRates(std::unordered_map<RegionId,Attributes>& attributes_hpv,
-         std::unordered_map<RegionId,Attributes>& attributes_pv,
+sumRates(std::vector<Scalar>& sums,
          Parallel::Communication comm)
 {
-    for (const auto& reg : rmap_.activeRegions()) {
-        // Calculating first using the hydrocarbon pore volumes
-        auto& ra = attr_.attributes(reg);
-        const auto& attri_hpv = attributes_hpv[reg];
-        ra.data = attri_hpv.data;
-        comm.sum(ra.data.data(), ra.data.size());
+    // All regions and both weightings in a single reduction.
+    comm.sum(sums.data(), sums.size());
+
+    const auto& regions = rmap_.activeRegions();
+    const std::size_t numRegions = regions.size();
+    const Scalar* hpvSums = sums.data();
+    const Scalar* pvSums = sums.data() + NumAttributes * numRegions;
+
+    for (std::size_t i = 0; i < numRegions; ++i) {
+        auto& ra = attr_.attributes(regions[i]);
+        // Use the hydrocarbon pore volumes to do the averaging, or the
+        // full pore volumes if there is no hydrocarbon pore volume.
         // TODO: should we have some epsilon here instead of zero?
-        // No hydrocarbon pore volume, redo but this time using full pore volumes.
-        if (ra.pv <= 0.) {
-            // using the pore volume to do the averaging
-            const auto& attri_pv = attributes_pv[reg];
-            ra.data = attri_pv.data;
-            comm.sum(ra.data.data(), ra.data.size());
-            assert(ra.pv > 0.);
+        const Scalar* regionSums =
+            (hpvSums[PoreVolume * numRegions + i] > 0.) ? hpvSums : pvSums;
+        for (std::size_t attr = 0; attr < NumAttributes; ++attr) {
+            ra.data[attr] = regionSums[attr * numRegions + i];
         }
+        assert(ra.pv > 0.);
+
         const Scalar pv_sum = ra.pv;
         std::ranges::transform(ra.data, ra.data.begin(),
                                [pv_sum](const auto d) { return d / pv_sum; });
@@ -378,8 +382,7 @@ using FS = BlackOilFluidSystem<Scalar, BlackOilDefaultFluidSystemIndices>;
 
 #define INSTANTIATE_TYPE(T)                                              \
     template void SurfaceToReservoirVoidage<FS<T>,std::vector<int>>::    \
-        sumRates(std::unordered_map<int,Attributes>&,                    \
-                 std::unordered_map<int,Attributes>&,                    \
+        sumRates(std::vector<T>&,                                        \
                  Parallel::Communication);                               \
     template void SurfaceToReservoirVoidage<FS<T>,std::vector<int>>::    \
         calcInjCoeff(const int, const int,                               \
@@ -24,6 +24,8 @@
 
 #include <opm/grid/utility/RegionMapping.hpp>
 
+#include <opm/simulators/flow/countGlobalCells.hpp>
+
 #include <opm/simulators/wells/RegionAttributeHelpers.hpp>
 
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
@@ -32,12 +34,20 @@
 #include <dune/grid/common/gridenums.hh>
 #include <dune/grid/common/rangegenerators.hh>
 
+#include <algorithm>
 #include <array>
 #include <cassert>
-#include <unordered_map>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <tuple>
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 /**
  * \file
  * Facility for converting component rates at surface conditions to
@@ -79,7 +89,15 @@ namespace Opm {
             SurfaceToReservoirVoidage(const Region&     region)
                 : rmap_      (region)
                 , attr_      (rmap_, Attributes())
-            {}
+                , regionIndex_(region.size(), -1)
+            {
+                const auto& regions = rmap_.activeRegions();
+                for (std::size_t i = 0; i < regions.size(); ++i) {
+                    for (const auto& cell : rmap_.cells(regions[i])) {
+                        regionIndex_[cell] = static_cast<int>(i);
+                    }
+                }
+            }
 
             /**
              * Compute pore volume averaged hydrocarbon state pressure, rs and rv.
@@ -88,119 +106,100 @@ namespace Opm {
              * state for purpose of conversion from surface rate to
              * reservoir voidage rate.
              *
+             * The averages are formed from the cached intensive
+             * quantities of the interior cells, in parallel if OpenMP is
+             * enabled, and reduced across all ranks in a single
+             * collective operation.
              */
             template <typename ElementContext, class Simulator>
             void defineState(const Simulator& simulator)
             {
-                // create map from cell to region and set all attributes to
-                // zero
-                for (const auto& reg : rmap_.activeRegions()) {
-                    auto& ra = attr_.attributes(reg);
-                    ra.pressure = 0.0;
-                    ra.temperature = 0.0;
-                    ra.rs = 0.0;
-                    ra.rv = 0.0;
-                    ra.pv = 0.0;
-                    ra.saltConcentration = 0.0;
-                    ra.rsw = 0.0;
-                    ra.rvw = 0.0;
-                }
-
-                // quantities for pore volume average
-                std::unordered_map<RegionId, Attributes> attributes_pv;
-
-                // quantities for hydrocarbon volume average
-                std::unordered_map<RegionId, Attributes> attributes_hpv;
-
-                for (const auto& reg : rmap_.activeRegions()) {
-                    attributes_pv.insert({reg, Attributes()});
-                    attributes_hpv.insert({reg, Attributes()});
-                }
-
-                ElementContext elemCtx( simulator );
                 const auto& gridView = simulator.gridView();
                 const auto& comm = gridView.comm();
 
-                OPM_BEGIN_PARALLEL_TRY_CATCH();
-                for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
-                    elemCtx.updatePrimaryStencil(elem);
-                    elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-                    const unsigned cellIdx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-                    const auto& intQuants = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
-                    const auto& fs = intQuants.fluidState();
-                    // use pore volume weighted averages.
-                    const Scalar pv_cell =
-                            simulator.model().dofTotalVolume(simulator.vanguard().gridEquilIdxToGridIdx(cellIdx))
-                            * intQuants.porosity().value();
-
-                    // only count oil and gas filled parts of the domain
-                    Scalar hydrocarbon = 1.0;
-                    if (FluidSystem::phaseIsActive(FluidSystem::waterPhaseIdx)) {
-                        hydrocarbon -= fs.saturation(FluidSystem::waterPhaseIdx).value();
-                    }
-
-                    const int reg = rmap_.region(cellIdx);
-                    assert(reg >= 0);
-
-                    // sum p, rs, rv, and T.
-                    const Scalar hydrocarbonPV = pv_cell*hydrocarbon;
-                    if (hydrocarbonPV > 0.) {
-                        auto& attr = attributes_hpv[reg];
-                        attr.pv += hydrocarbonPV;
-                        if (FluidSystem::phaseIsActive(FluidSystem::oilPhaseIdx) && FluidSystem::phaseIsActive(FluidSystem::gasPhaseIdx)) {
-                            attr.rs += fs.Rs().value() * hydrocarbonPV;
-                            attr.rv += fs.Rv().value() * hydrocarbonPV;
-                        }
-                        if (FluidSystem::phaseIsActive(FluidSystem::oilPhaseIdx)) {
-                            attr.pressure += fs.pressure(FluidSystem::oilPhaseIdx).value() * hydrocarbonPV;
-                            attr.temperature += fs.temperature(FluidSystem::oilPhaseIdx).value() * hydrocarbonPV;
-                        } else {
-                            assert(FluidSystem::phaseIsActive(FluidSystem::gasPhaseIdx));
-                            attr.pressure += fs.pressure(FluidSystem::gasPhaseIdx).value() * hydrocarbonPV;
-                            attr.temperature += fs.temperature(FluidSystem::gasPhaseIdx).value() * hydrocarbonPV;
-                        }
-                        attr.saltConcentration += fs.saltConcentration().value() * hydrocarbonPV;
-                        if (FluidSystem::enableDissolvedGasInWater()) {
-                            attr.rsw += fs.Rsw().value() * hydrocarbonPV; // scale with total volume?
-                        }
-                        if (FluidSystem::enableVaporizedWater()) {
-                            attr.rvw += fs.Rvw().value() * hydrocarbonPV; // scale with total volume?
-                        }
-                    }
+                const std::size_t numRegions = rmap_.activeRegions().size();
+                const int numInterior = detail::countLocalInteriorCellsGridView(gridView);
+
+                // Hydrocarbon pore volume weighted sums of all attributes,
+                // followed by pore volume weighted sums, for each thread.
+#ifdef _OPENMP
+                threadSums_.resize(omp_get_max_threads());
+#else
+                threadSums_.resize(1);
+#endif
+                // Zero every buffer here, not in the parallel region.  The team
+                // may have fewer threads than buffers, and all buffers are
+                // added in the reduction below.
+                for (auto& sums : threadSums_) {
+                    sums.assign(2 * NumAttributes * numRegions, 0.0);
+                }
 
-                    if (pv_cell > 0.) {
-                        auto& attr = attributes_pv[reg];
-                        attr.pv += pv_cell;
-                        if (FluidSystem::phaseIsActive(FluidSystem::oilPhaseIdx) && FluidSystem::phaseIsActive(FluidSystem::gasPhaseIdx)) {
-                            attr.rs += fs.Rs().value() * pv_cell;
-                            attr.rv += fs.Rv().value() * pv_cell;
-                        }
-                        if (FluidSystem::phaseIsActive(FluidSystem::oilPhaseIdx)) {
-                            attr.pressure += fs.pressure(FluidSystem::oilPhaseIdx).value() * pv_cell;
-                            attr.temperature += fs.temperature(FluidSystem::oilPhaseIdx).value() * pv_cell;
-                        } else if (FluidSystem::phaseIsActive(FluidSystem::gasPhaseIdx)) {
-                             attr.pressure += fs.pressure(FluidSystem::gasPhaseIdx).value() * pv_cell;
-                             attr.temperature += fs.temperature(FluidSystem::gasPhaseIdx).value() * pv_cell;
-                        } else {
-                            assert(FluidSystem::phaseIsActive(FluidSystem::waterPhaseIdx));
-                            attr.pressure += fs.pressure(FluidSystem::waterPhaseIdx).value() * pv_cell;
-                            attr.temperature += fs.temperature(FluidSystem::waterPhaseIdx).value() * pv_cell;
-                        }
-                        attr.saltConcentration += fs.saltConcentration().value() * pv_cell;
-                        if (FluidSystem::enableDissolvedGasInWater()) {
-                            attr.rsw += fs.Rsw().value() * pv_cell;
+                OPM_BEGIN_PARALLEL_TRY_CATCH();
+                std::exception_ptr failure;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+                {
+#ifdef _OPENMP
+                    auto& sums = threadSums_[omp_get_thread_num()];
+#else
+                    auto& sums = threadSums_[0];
+#endif
+
+#ifdef _OPENMP
+#pragma omp for
+#endif
+                    for (int cellIdx = 0; cellIdx < numInterior; ++cellIdx) {
+                        try {
+                            const auto& intQuants = simulator.model().intensiveQuantities(cellIdx, /*timeIdx=*/0);
+                            const auto& fs = intQuants.fluidState();
+                            // use pore volume weighted averages.
+                            const Scalar pv_cell =
+                                    simulator.model().dofTotalVolume(simulator.vanguard().gridEquilIdxToGridIdx(cellIdx))
+                                    * intQuants.porosity().value();
+
+                            // only count oil and gas filled parts of the domain
+                            Scalar hydrocarbon = 1.0;
+                            if (FluidSystem::phaseIsActive(FluidSystem::waterPhaseIdx)) {
+                                hydrocarbon -= fs.saturation(FluidSystem::waterPhaseIdx).value();
+                            }
+
+                            const int reg = regionIndex_[cellIdx];
+                            assert(reg >= 0);
+
+                            // sum p, rs, rv, and T.
+                            const Scalar hydrocarbonPV = pv_cell*hydrocarbon;
+                            if (hydrocarbonPV > 0.) {
+                                addCell(fs, hydrocarbonPV, reg, numRegions, sums.data());
+                            }
+
+                            if (pv_cell > 0.) {
+                                addCell(fs, pv_cell, reg, numRegions,
+                                        sums.data() + NumAttributes * numRegions);
+                            }
                         }
-                        if (FluidSystem::enableVaporizedWater()) {
-                            attr.rvw += fs.Rvw().value() * pv_cell;
+                        catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(define_state_failure)
+#endif
+                            if (!failure) {
+                                failure = std::current_exception();
+                            }
                         }
                     }
                 }
+                if (failure) {
+                    std::rethrow_exception(failure);
+                }
 
                 OPM_END_PARALLEL_TRY_CATCH("SurfaceToReservoirVoidage::defineState() failed: ", simulator.vanguard().grid().comm());
 
-                this->sumRates(attributes_hpv,
-                               attributes_pv,
-                               comm);
+                auto& sums = threadSums_[0];
+                for (std::size_t thread = 1; thread < threadSums_.size(); ++thread) {
+                    std::ranges::transform(sums, threadSums_[thread], sums.begin(), std::plus<>{});
+                }
+
+                this->sumRates(sums, comm);
             }
 
             /**
@@ -410,11 +409,90 @@ namespace Opm {
                 Scalar& saltConcentration;
             };
 
-            void sumRates(std::unordered_map<RegionId,Attributes>& attributes_hpv,
-                          std::unordered_map<RegionId,Attributes>& attributes_pv,
+            /**
+             * Position of each attribute in Attributes::data, for the
+             * dense per-region sums in defineState().
+             */
+            enum AttributeIndex : std::size_t {
+                Pressure, Temperature, Rs, Rv, Rsw, Rvw, PoreVolume, SaltConcentration,
+                NumAttributes
+            };
+
+            static_assert(NumAttributes == std::tuple_size_v<decltype(Attributes::data)>);
+
+            /**
+             * Add weighted attributes of a single cell to the per-region
+             * sums.
+             *
+             * \param[in] fs Fluid state of cell.
+             * \param[in] weight Pore volume or hydrocarbon pore volume of cell.
+             * \param[in] reg Dense index of cell's region.
+             * \param[in] numRegions Number of active regions.
+             * \param[in,out] sums Sums of each attribute for each region,
+             *    one attribute after the other.
+             */
+            template <class FluidState>
+            static void addCell(const FluidState& fs,
+                                const Scalar      weight,
+                                const int         reg,
+                                const std::size_t numRegions,
+                                Scalar*           sums)
+            {
+                const auto add = [weight, reg, numRegions, sums](const AttributeIndex attr,
+                                                                 const Scalar value)
+                {
+                    sums[attr * numRegions + reg] += value * weight;
+                };
+
+                sums[PoreVolume * numRegions + reg] += weight;
+                if (FluidSystem::phaseIsActive(FluidSystem::oilPhaseIdx) && FluidSystem::phaseIsActive(FluidSystem::gasPhaseIdx)) {
+                    add(Rs, fs.Rs().value());
+                    add(Rv, fs.Rv().value());
+                }
+                if (FluidSystem::phaseIsActive(FluidSystem::oilPhaseIdx)) {
+                    add(Pressure, fs.pressure(FluidSystem::oilPhaseIdx).value());
+                    add(Temperature, fs.temperature(FluidSystem::oilPhaseIdx).value());
+                } else if (FluidSystem::phaseIsActive(FluidSystem::gasPhaseIdx)) {
+                    add(Pressure, fs.pressure(FluidSystem::gasPhaseIdx).value());
+                    add(Temperature, fs.temperature(FluidSystem::gasPhaseIdx).value());
+                } else {
+                    assert(FluidSystem::phaseIsActive(FluidSystem::waterPhaseIdx));
+                    add(Pressure, fs.pressure(FluidSystem::waterPhaseIdx).value());
+                    add(Temperature, fs.temperature(FluidSystem::waterPhaseIdx).value());
+                }
+                add(SaltConcentration, fs.saltConcentration().value());
+                if (FluidSystem::enableDissolvedGasInWater()) {
+                    add(Rsw, fs.Rsw().value());
+                }
+                if (FluidSystem::enableVaporizedWater()) {
+                    add(Rvw, fs.Rvw().value());
+                }
+            }
+
+            /**
+             * Reduce the per-region sums across all ranks and assign the
+             * resulting averages to the region attributes.
+             *
+             * \param[in,out] sums Hydrocarbon pore volume weighted sums of
+             *    each attribute for each region, followed by the pore
+             *    volume weighted sums.  Reduced in place.
+             * \param[in] comm Communication object of the grid.
+             */
+            void sumRates(std::vector<Scalar>& sums,
                           Parallel::Communication comm);
 
             RegionAttributeHelpers::RegionAttributes<RegionId, Attributes> attr_;
+
+            /**
+             * Dense index, into the active regions, of each cell's region.
+             */
+            std::vector<int> regionIndex_;
+
+            /**
+             * Per-thread sums of defineState().  Kept to reuse the
+             * allocations across calls.
+             */
+            std::vector<std::vector<Scalar>> threadSums_;
         };
 
     } // namespace RateConverter
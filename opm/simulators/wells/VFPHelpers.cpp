@@ -29,8 +29,10 @@
 #include <opm/input/eclipse/Schedule/VFPInjTable.hpp>
 #include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <iterator>
 #include <stdexcept>
 
 namespace {
@@ -83,6 +85,15 @@ namespace Opm {
 template<class Scalar>
 detail::InterpData<Scalar> VFPHelpers<Scalar>::findInterpData(const Scalar value_in,
                                                               const std::vector<double>& values)
+{
+    int hint = 0;
+    return findInterpData(value_in, values, hint);
+}
+
+template<class Scalar>
+detail::InterpData<Scalar> VFPHelpers<Scalar>::findInterpData(const Scalar value_in,
+                                                              const std::vector<double>& values,
+                                                              int& hint)
 {
     detail::InterpData<Scalar> retval;
 
@@ -112,15 +123,31 @@ detail::InterpData<Scalar> VFPHelpers<Scalar>::findInterpData(const Scalar value
             retval.ind_[1] = nvalues-1;
         }
         else {
-            //Search internal intervals
-            for (int i=1; i<nvalues; ++i) {
-                if (values[i] >= value) {
-                    retval.ind_[0] = i-1;
-                    retval.ind_[1] = i;
-                    break;
-                }
+            //Search internal intervals for the first value greater than or
+            //equal to value. Interval i holds it if values[i] < value <= values[i+1].
+            auto holds = [&values, value](const int i)
+            {
+                return values[i] < value && value <= values[i+1];
+            };
+            const int guess = std::clamp(hint, 0, nvalues-2);
+            int i = 0;
+            if (holds(guess)) {
+                i = guess;
             }
+            else if (guess + 1 < nvalues - 1 && holds(guess + 1)) {
+                i = guess + 1;
+            }
+            else if (guess > 0 && holds(guess - 1)) {
+                i = guess - 1;
+            }
+            else {
+                const auto it = std::lower_bound(values.begin() + 1, values.end(), value);
+                i = std::distance(values.begin(), it) - 1;
+            }
+            retval.ind_[0] = i;
+            retval.ind_[1] = i+1;
         }
+        hint = retval.ind_[0];
 
         const Scalar start = values[retval.ind_[0]];
         const Scalar end   = values[retval.ind_[1]];
@@ -315,7 +342,8 @@ bhp(const VFPProdTable& table,
     const Scalar alq,
     const Scalar explicit_wfr,
     const Scalar explicit_gfr,
-    const bool   use_vfpexplicit)
+    const bool   use_vfpexplicit,
+    detail::VFPInterpHint* hint)
 {
     //Find interpolation variables
     Scalar flo = detail::getFlo(table, aqua, liquid, vapour);
@@ -328,11 +356,13 @@ bhp(const VFPProdTable& table,
 
     //First, find the values to interpolate between
     //Recall that flo is negative in Opm, so switch sign.
-    auto flo_i = findInterpData(-flo, table.getFloAxis());
-    auto thp_i = findInterpData( thp, table.getTHPAxis());
-    auto wfr_i = findInterpData( wfr, table.getWFRAxis());
-    auto gfr_i = findInterpData( gfr, table.getGFRAxis());
-    auto alq_i = findInterpData( alq, table.getALQAxis());
+    detail::VFPInterpHint no_hint{};
+    auto& h = hint ? *hint : no_hint;
+    auto flo_i = findInterpData(-flo, table.getFloAxis(), h.flo);
+    auto thp_i = findInterpData( thp, table.getTHPAxis(), h.thp);
+    auto wfr_i = findInterpData( wfr, table.getWFRAxis(), h.wfr);
+    auto gfr_i = findInterpData( gfr, table.getGFRAxis(), h.gfr);
+    auto alq_i = findInterpData( alq, table.getALQAxis(), h.alq);
 
     detail::VFPEvaluation retval = interpolate(table, flo_i, thp_i, wfr_i, gfr_i, alq_i);
 
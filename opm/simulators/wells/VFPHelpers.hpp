@@ -70,6 +70,20 @@ struct InterpData
     Scalar factor_; // Interpolation factor
 };
 
+/**
+ * Intervals found by the last bhp lookup on each axis of a production
+ * table. Kept per well so that the next lookup, which typically lands
+ * in the same intervals, can skip the bisection.
+ */
+struct VFPInterpHint
+{
+    int flo = 0;
+    int thp = 0;
+    int wfr = 0;
+    int gfr = 0;
+    int alq = 0;
+};
+
 /**
  * Computes the flo parameter according to the flo_type_
  * for production tables
@@ -147,6 +161,20 @@ public:
     static detail::InterpData<Scalar> findInterpData(const Scalar value_in,
                                                      const std::vector<double>& values);
 
+    /**
+     * As findInterpData() above, but the interval search starts from the
+     * interval in hint, then tries its neighbours before falling back to
+     * bisection.
+     *  @param value_in Value to find in values
+     *  @param values Sorted list of values to search for value in.
+     *  @param hint Lower index of the interval found in a previous search.
+     *              Updated with the interval found.
+     *  @return Data required to find the interpolated value
+     */
+    static detail::InterpData<Scalar> findInterpData(const Scalar value_in,
+                                                     const std::vector<double>& values,
+                                                     int& hint);
+
     /**
      * Helper function which interpolates data using the indices etc. given in the inputs.
      */
@@ -173,7 +201,8 @@ public:
                                              const Scalar alq,
                                              const Scalar explicit_wfr,
                                              const Scalar explicit_gfr,
-                                             const bool   use_vfpexplicit);
+                                             const bool   use_vfpexplicit,
+                                             detail::VFPInterpHint* hint = nullptr);
 
     static detail::VFPEvaluation<Scalar> bhp(const VFPInjTable& table,
                                              const Scalar aqua,
@@ -66,8 +66,9 @@ thp(const int    table_id,
     auto gfr_i = VFPHelpers<Scalar>::findInterpData( gfr, table.getGFRAxis());
     auto alq_i = VFPHelpers<Scalar>::findInterpData( alq, table.getALQAxis());
     std::vector<Scalar> bhp_array(nthp);
+    int thp_hint = 0;
     for (int i = 0; i < nthp; ++i) {
-        auto thp_i = VFPHelpers<Scalar>::findInterpData(thp_array[i], thp_array);
+        auto thp_i = VFPHelpers<Scalar>::findInterpData(thp_array[i], thp_array, thp_hint);
         bhp_array[i] = VFPHelpers<Scalar>::interpolate(table, flo_i, thp_i, wfr_i, gfr_i, alq_i).value;
     }
 
@@ -84,13 +85,14 @@ bhp(const int     table_id,
      const Scalar alq,
      const Scalar explicit_wfr,
      const Scalar explicit_gfr,
-     const bool   use_expvfp) const
+     const bool   use_expvfp,
+     detail::VFPInterpHint* hint) const
 {
     const VFPProdTable& table = detail::getTable(m_tables, table_id);
 
     detail::VFPEvaluation retval = VFPHelpers<Scalar>::bhp(table, aqua, liquid, vapour,
                                                            thp_arg, alq, explicit_wfr,
-                                                           explicit_gfr, use_expvfp);
+                                                           explicit_gfr, use_expvfp, hint);
     return retval.value;
 }
 
@@ -126,9 +128,11 @@ bhpwithflo(const std::vector<Scalar>& flos,
     const auto alq_i = VFPHelpers<Scalar>::findInterpData( alq, table.getALQAxis()); //assume constant
 
     std::vector<Scalar> bhps(flos.size(), 0.);
+    // the rates are usually sampled in order, so start from the previous interval
+    int flo_hint = 0;
     for (std::size_t i = 0; i < flos.size(); ++i) {
         // Value of FLO is negative in OPM for producers, but positive in VFP table
-        const auto flo_i = VFPHelpers<Scalar>::findInterpData(-flos[i], table.getFloAxis());
+        const auto flo_i = VFPHelpers<Scalar>::findInterpData(-flos[i], table.getFloAxis(), flo_hint);
         const detail::VFPEvaluation bhp_val = VFPHelpers<Scalar>::interpolate(table, flo_i, thp_i, wfr_i, gfr_i, alq_i);
 
         // TODO: this kind of breaks the conventions for the functions here by putting dp within the function
@@ -170,7 +174,8 @@ bhp(const int       table_id,
     const Scalar    alq,
     const Scalar    explicit_wfr,
     const Scalar    explicit_gfr,
-    const bool      use_expvfp) const
+    const bool      use_expvfp,
+    detail::VFPInterpHint* hint) const
 {
     //Get the table
     const VFPProdTable& table = detail::getTable(m_tables, table_id);
@@ -187,11 +192,13 @@ bhp(const int       table_id,
 
     //First, find the values to interpolate between
     //Value of FLO is negative in OPM for producers, but positive in VFP table
-    auto flo_i = VFPHelpers<Scalar>::findInterpData(-flo.value(), table.getFloAxis());
-    auto thp_i = VFPHelpers<Scalar>::findInterpData( thp, table.getTHPAxis()); // assume constant
-    auto wfr_i = VFPHelpers<Scalar>::findInterpData( wfr.value(), table.getWFRAxis());
-    auto gfr_i = VFPHelpers<Scalar>::findInterpData( gfr.value(), table.getGFRAxis());
-    auto alq_i = VFPHelpers<Scalar>::findInterpData( alq, table.getALQAxis()); //assume constant
+    detail::VFPInterpHint no_hint{};
+    auto& h = hint ? *hint : no_hint;
+    auto flo_i = VFPHelpers<Scalar>::findInterpData(-flo.value(), table.getFloAxis(), h.flo);
+    auto thp_i = VFPHelpers<Scalar>::findInterpData( thp, table.getTHPAxis(), h.thp); // assume constant
+    auto wfr_i = VFPHelpers<Scalar>::findInterpData( wfr.value(), table.getWFRAxis(), h.wfr);
+    auto gfr_i = VFPHelpers<Scalar>::findInterpData( gfr.value(), table.getGFRAxis(), h.gfr);
+    auto alq_i = VFPHelpers<Scalar>::findInterpData( alq, table.getALQAxis(), h.alq); //assume constant
 
     detail::VFPEvaluation bhp_val = VFPHelpers<Scalar>::interpolate(table, flo_i, thp_i, wfr_i,
                                                                     gfr_i, alq_i);
@@ -211,7 +218,8 @@ bhp(const int       table_id,
                               const T ,           \
                               const T ,           \
                               const T ,           \
-                              const bool) const;
+                              const bool,         \
+                              detail::VFPInterpHint*) const;
 
 #define INSTANTIATE_TYPE(T)                        \
     template class VFPProdProperties<T>;           \
@@ -29,6 +29,10 @@ namespace Opm {
 
 class VFPProdTable;
 
+namespace detail {
+struct VFPInterpHint;
+}
+
 /**
  * Class which linearly interpolates BHP as a function of rate, tubing head pressure,
  * water fraction, gas fraction, and artificial lift for production VFP tables, and similarly
@@ -57,6 +61,8 @@ public:
      * @param explicit_wfr Explicit wfr
      * @param explicit_gfr Explicit gfr
      * @param use_expvfp True to use explicit VFP calculations
+     * @param hint Optional intervals from the previous lookup for the same
+     *             well, updated with the intervals found.
      *
      * @return The bottom hole pressure, interpolated/extrapolated linearly using
      * the above parameters from the values in the input table, for each entry in the
@@ -71,7 +77,8 @@ public:
                  const Scalar    alq,
                  const Scalar    explicit_wfr,
                  const Scalar    explicit_gfr,
-                 const bool      use_expvfp) const;
+                 const bool      use_expvfp,
+                 detail::VFPInterpHint* hint = nullptr) const;
 
     /**
      * Linear interpolation of bhp as a function of the input parameters
@@ -84,6 +91,8 @@ public:
      * @param explicit_wfr Explicit wfr
      * @param explicit_gfr Explicit gfr
      * @param use_expvfp True to use explicit VFP calculations
+     * @param hint Optional intervals from the previous lookup for the same
+     *             well, updated with the intervals found.
      *
      * @return The bottom hole pressure, interpolated/extrapolated linearly using
      * the above parameters from the values in the input table.
@@ -96,7 +105,8 @@ public:
                const Scalar alq,
                const Scalar explicit_wfr,
                const Scalar explicit_gfr,
-               const bool   use_expvfp) const;
+               const bool   use_expvfp,
+               detail::VFPInterpHint* hint = nullptr) const;
 
     /**
      * Linear interpolation of thp as a function of the input parameters
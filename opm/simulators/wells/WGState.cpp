@@ -61,6 +61,14 @@ bool WGState<Scalar, IndexTraits>::operator==(const WGState& rhs) const
            this->well_test_state == rhs.well_test_state;
 }
 
+template<typename Scalar, typename IndexTraits>
+void WGState<Scalar, IndexTraits>::assign(const WGState& other)
+{
+    this->well_state.assign(other.well_state);
+    this->group_state.assign(other.group_state);
+    this->well_test_state = other.well_test_state;
+}
+
 template struct Opm::WGState<double, BlackOilDefaultFluidSystemIndices>;
 
 #if FLOW_INSTANTIATE_FLOAT
@@ -43,12 +43,18 @@ struct WGState
 
     void wtest_state(std::unique_ptr<WellTestState> wtest_state);
 
+    // Remember to update assign(), operator==() and serializeOp() when
+    // adding members.
     WellState<Scalar, IndexTraits> well_state;
     GroupState<Scalar> group_state;
     WellTestState well_test_state;
 
     bool operator==(const WGState&) const;
 
+    /// Copy the state of other into this object, reusing the storage
+    /// already allocated here. Used when saving and restoring states.
+    void assign(const WGState& other);
+
     template<class Serializer>
     void serializeOp(Serializer& serializer)
     {
@@ -246,7 +246,8 @@ computeBhpAtThpLimitProd(const std::function<std::vector<Scalar>(const Scalar)>&
                                                                  alq_value,
                                                                  wfr,
                                                                  gfr,
-                                                                 use_vfpexp);
+                                                                 use_vfpexp,
+                                                                 &well_.vfpInterpHint());
         return bhp - dp + getVfpBhpAdjustment(bhp, thp_limit);
     };
 
@@ -386,7 +387,8 @@ calculateBhpFromThp(const WellState<Scalar, IndexTraits>& well_state,
                                                       aqua, liquid, vapour,
                                                       thp_limit,
                                                       well_.getALQ(well_state),
-                                                      wfr, gfr, use_vfpexplicit);
+                                                      wfr, gfr, use_vfpexplicit,
+                                                      &well_.vfpInterpHint());
     }
     else {
         OPM_DEFLOG_THROW(std::logic_error, "Expected INJECTOR or PRODUCER for well " + well_.name(), deferred_logger);
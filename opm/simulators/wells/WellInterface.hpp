@@ -286,7 +286,12 @@ public:
                                           const bool use_well_weights,
                                           const WellStateType& well_state) const = 0;
 
-    void addCellRates(std::map<int, RateVector>& cellRates_) const;
+    /// Add the connection rates to the rates of the perforated cells.
+    /// \param cellRates Rates of the perforated cells
+    /// \param cellRateIndex Position of the rates of each cell in cellRates,
+    ///                      negative for cells that are not perforated
+    void addCellRates(std::vector<RateVector>& cellRates,
+                      const std::vector<int>& cellRateIndex) const;
 
     Scalar volumetricSurfaceRateForConnection(int cellIdx, int phaseIdx) const;
 
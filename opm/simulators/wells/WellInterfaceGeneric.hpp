@@ -27,6 +27,7 @@
 #include <opm/input/eclipse/Schedule/Well/Well.hpp>
 #include <opm/simulators/flow/BlackoilModelParameters.hpp>
 #include <opm/simulators/wells/RuntimePerforation.hpp>
+#include <opm/simulators/wells/VFPHelpers.hpp>
 
 #include <ctime>
 #include <map>
@@ -145,6 +146,8 @@ public:
 
     const VFPProperties<Scalar, IndexTraits>* vfpProperties() const { return vfp_properties_; }
 
+    detail::VFPInterpHint& vfpInterpHint() const { return vfp_interp_hint_; }
+
     const ParallelWellInfo<Scalar>& parallelWellInfo() const { return parallel_well_info_; }
 
     const std::vector<Scalar>& perfDepth() const { return perf_depth_; }
@@ -369,6 +372,10 @@ protected:
     mutable std::vector<Scalar> ipr_a_;
     mutable std::vector<Scalar> ipr_b_;
 
+    // table intervals found by the last production VFP lookup for this well,
+    // used as the starting point for the next one
+    mutable detail::VFPInterpHint vfp_interp_hint_{};
+
     // cell index for each well perforation
     std::vector<int> well_cells_;
 
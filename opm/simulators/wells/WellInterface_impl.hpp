@@ -1174,20 +1174,22 @@ namespace Opm
 
     template<typename TypeTag>
     void
-    WellInterface<TypeTag>::addCellRates(std::map<int, RateVector>& cellRates_) const
+    WellInterface<TypeTag>::addCellRates(std::vector<RateVector>& cellRates,
+                                         const std::vector<int>& cellRateIndex) const
     {
         if(!this->operability_status_.solvable)
             return;
 
         for (int perfIdx = 0; perfIdx < this->number_of_local_perforations_; ++perfIdx) {
-            const auto cellIdx = this->cells()[perfIdx];
-            const auto it = cellRates_.find(cellIdx);
-            RateVector rates = (it == cellRates_.end()) ? 0.0 : it->second;
+            const int idx = cellRateIndex[this->cells()[perfIdx]];
+            if (idx < 0) {
+                continue;
+            }
+            auto& rates = cellRates[idx];
             for (auto i=0*RateVector::dimension; i < RateVector::dimension; ++i)
             {
                 rates[i] += connectionRates_[perfIdx][i];
             }
-            cellRates_.insert_or_assign(cellIdx, rates);
         }
     }
 
@@ -1449,6 +1449,17 @@ bool WellState<Scalar, IndexTraits>::operator==(const WellState& rhs) const
            this->permanently_inactive_well_names_ == rhs.permanently_inactive_well_names_;
 }
 
+template<typename Scalar, typename IndexTraits>
+void WellState<Scalar, IndexTraits>::assign(const WellState& other)
+{
+    this->enableDistributedWells_ = other.enableDistributedWells_;
+    this->phaseUsageInfo_ = other.phaseUsageInfo_;
+    this->wells_ = other.wells_;
+    this->global_well_info = other.global_well_info;
+    assignMapValues(this->well_rates, other.well_rates);
+    this->permanently_inactive_well_names_ = other.permanently_inactive_well_names_;
+}
+
 template<typename Scalar, typename IndexTraits>
 const ParallelWellInfo<Scalar>&
 WellState<Scalar, IndexTraits>::parallelWellInfo(std::size_t well_index) const
@@ -335,6 +335,12 @@ public:
 
     bool operator==(const WellState&) const;
 
+    /// Copy the state of other into this object. Unlike the copy
+    /// assignment operator this keeps the storage of the well rate
+    /// vectors when both states hold the same wells. Copies each
+    /// member, so it must be updated when members are added.
+    void assign(const WellState& other);
+
     template<class Serializer>
     void serializeOp(Serializer& serializer)
     {
@@ -360,6 +366,8 @@ public:
     }
 
 private:
+    // Remember to update assign(), operator==() and serializeOp() when
+    // adding members.
     bool enableDistributedWells_ = false;
 
     PhaseUsageInfo<IndexTraits> phaseUsageInfo_;
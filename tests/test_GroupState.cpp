@@ -73,3 +73,30 @@ BOOST_AUTO_TEST_CASE(GroupStateCreate)
     gs.communicate_rates(comm);
     BOOST_CHECK(gs2 == gs);
 }
+
+BOOST_AUTO_TEST_CASE(GroupStateAssign)
+{
+    const auto reference = GroupState<double>::serializationTestObject();
+    GroupState<double> gs(3);
+    gs.assign(reference);
+    BOOST_CHECK(gs == reference);
+
+    GroupState<double> src(3);
+    src.update_production_rates("AGROUP", {0, 1, 2});
+    src.update_production_rates("BGROUP", {3, 4, 5});
+    GroupState<double> dst(3);
+    dst.assign(src);
+    BOOST_CHECK(dst == src);
+
+    // Assigning a state with the same groups keeps the rate vectors.
+    const double* rates = dst.production_rates("BGROUP").data();
+    src.update_production_rates("BGROUP", {6, 7, 8});
+    dst.assign(src);
+    BOOST_CHECK(dst == src);
+    BOOST_CHECK(dst.production_rates("BGROUP").data() == rates);
+
+    // A different set of groups is copied.
+    src.update_production_rates("CGROUP", {9, 10, 11});
+    dst.assign(src);
+    BOOST_CHECK(dst == src);
+}
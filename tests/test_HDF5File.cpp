@@ -56,6 +56,48 @@ BOOST_AUTO_TEST_CASE(ReadWrite)
     std::filesystem::remove(path);
 }
 
+BOOST_AUTO_TEST_CASE(ReadWriteCollective)
+{
+    auto path = std::filesystem::temp_directory_path() / Opm::unique_path("hdf5test%%%%%");
+    std::filesystem::create_directory(path);
+    auto rwpath = (path / "rw_collective.hdf5").string();
+#if HAVE_MPI
+    Opm::Parallel::Communication comm{MPI_COMM_SELF};
+#else
+    Opm::Parallel::Communication comm{};
+#endif
+    const std::vector<char> test_data{1,2,3,4,5,6,8,9};
+    for (const bool compress : {true, false}) {
+        {
+            Opm::HDF5File out_file(rwpath, Opm::HDF5File::OpenMode::OVERWRITE, comm, compress);
+            BOOST_CHECK_NO_THROW(out_file.write("/test_data", "d1", test_data,
+                                                Opm::HDF5File::DataSetMode::COLLECTIVE));
+            BOOST_CHECK_NO_THROW(out_file.write("/test_data", "d2", test_data));
+        }
+        {
+            Opm::HDF5File in_file(rwpath, Opm::HDF5File::OpenMode::READ, comm);
+            std::vector<char> data;
+            BOOST_CHECK_NO_THROW(in_file.read("/test_data", "d1", data,
+                                              Opm::HDF5File::DataSetMode::COLLECTIVE));
+            BOOST_CHECK_EQUAL_COLLECTIONS(data.begin(), data.end(),
+                                          test_data.begin(), test_data.end());
+
+            // Either layout can be read using either mode
+            data.clear();
+            BOOST_CHECK_NO_THROW(in_file.read("/test_data", "d1", data));
+            BOOST_CHECK_EQUAL_COLLECTIONS(data.begin(), data.end(),
+                                          test_data.begin(), test_data.end());
+            data.clear();
+            BOOST_CHECK_NO_THROW(in_file.read("/test_data", "d2", data,
+                                              Opm::HDF5File::DataSetMode::COLLECTIVE));
+            BOOST_CHECK_EQUAL_COLLECTIONS(data.begin(), data.end(),
+                                          test_data.begin(), test_data.end());
+        }
+    }
+    std::filesystem::remove(rwpath);
+    std::filesystem::remove(path);
+}
+
 BOOST_AUTO_TEST_CASE(ThrowOpenNonexistent)
 {
 #if HAVE_MPI
@@ -94,6 +94,64 @@ BOOST_AUTO_TEST_CASE(WriteRead)
     std::filesystem::remove(path);
 }
 
+BOOST_AUTO_TEST_CASE(WriteReadDelta)
+{
+    auto path = std::filesystem::temp_directory_path() / Opm::unique_path("hdf5test%%%%%");
+    std::filesystem::create_directory(path);
+    auto rwpath = (path / "rw.hdf5").string();
+#if HAVE_MPI
+    Parallel::Communication comm(MPI_COMM_SELF);
+#else
+    Parallel::Communication comm{};
+#endif
+    std::vector<double> step1(100000);
+    for (std::size_t i = 0; i < step1.size(); ++i) {
+        step1[i] = 0.001 * i;
+    }
+    std::vector<double> step2 = step1;
+    step2[10] = 2.0;
+    step2[90000] = 3.0;
+    // shifts the data after the insertion
+    std::vector<double> step3 = step2;
+    step3.insert(step3.begin() + 50000, 100, 4.0);
+    {
+        HDF5DeltaBase base;
+        HDF5Serializer ser(rwpath, HDF5File::OpenMode::OVERWRITE, comm);
+        ser.setDeltaBase(&base, true);
+        ser.write(step1, "/report_step/1", "test");
+        ser.setDeltaBase(&base, false);
+        ser.write(step2, "/report_step/2", "test");
+        ser.write(step3, "/report_step/3", "test");
+        BOOST_CHECK_EQUAL(base.group, "/report_step/1");
+    }
+    {
+        HDF5Serializer ser(rwpath, HDF5File::OpenMode::READ, comm);
+        std::vector<double> input;
+        ser.read(input, "/report_step/1", "test");
+        BOOST_CHECK_EQUAL_COLLECTIONS(input.begin(), input.end(),
+                                      step1.begin(), step1.end());
+        ser.read(input, "/report_step/2", "test");
+        BOOST_CHECK_EQUAL_COLLECTIONS(input.begin(), input.end(),
+                                      step2.begin(), step2.end());
+        ser.read(input, "/report_step/3", "test");
+        BOOST_CHECK_EQUAL_COLLECTIONS(input.begin(), input.end(),
+                                      step3.begin(), step3.end());
+    }
+    {
+        // Only the chunks around the changes are stored in the deltas
+        HDF5File file(rwpath, HDF5File::OpenMode::READ, comm);
+        std::vector<char> full, delta2, delta3;
+        file.read("/report_step/1", "test", full);
+        file.read("/report_step/2", "test_delta", delta2);
+        file.read("/report_step/3", "test_delta", delta3);
+        BOOST_CHECK_LT(delta2.size(), full.size() / 10);
+        BOOST_CHECK_LT(delta3.size(), full.size() / 10);
+    }
+
+    std::filesystem::remove(rwpath);
+    std::filesystem::remove(path);
+}
+
 bool init_unit_test_func()
 {
     return true;
@@ -0,0 +1,71 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <config.h>
+
+#define BOOST_TEST_MODULE AdaptiveSetupReuseTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/linalg/AdaptiveSetupReuse.hpp>
+
+BOOST_AUTO_TEST_CASE(NoRecreateWithoutIterationGrowth)
+{
+    Opm::AdaptiveSetupReuse reuse;
+    reuse.recordSetup(1.0);
+    for (int i = 0; i < 100; ++i) {
+        reuse.recordSolve(10, 0.5);
+        reuse.recordUpdate(0.1);
+        BOOST_CHECK(!reuse.shouldRecreate());
+    }
+    BOOST_CHECK_EQUAL(reuse.extraTime(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(RecreateWhenExtraIterationsCostMoreThanSetup)
+{
+    Opm::AdaptiveSetupReuse reuse;
+    reuse.recordSetup(1.0);
+    reuse.recordUpdate(0.25);
+
+    // Baseline of 10 iterations at 0.1 s per iteration.
+    reuse.recordSolve(10, 1.0);
+    BOOST_CHECK(!reuse.shouldRecreate());
+
+    // Each solve takes 2 iterations more, costing 0.2 s extra. The
+    // setup costs 0.75 s more than an update.
+    reuse.recordSolve(12, 1.2);
+    reuse.recordSolve(12, 1.2);
+    reuse.recordSolve(12, 1.2);
+    BOOST_CHECK_CLOSE(reuse.extraTime(), 0.6, 1e-10);
+    BOOST_CHECK(!reuse.shouldRecreate());
+    reuse.recordSolve(12, 1.2);
+    BOOST_CHECK(reuse.shouldRecreate());
+
+    // A new setup resets the accumulated cost and the baseline.
+    reuse.recordSetup(1.0);
+    BOOST_CHECK_EQUAL(reuse.extraTime(), 0.0);
+    BOOST_CHECK(!reuse.shouldRecreate());
+    reuse.recordSolve(12, 1.2);
+    reuse.recordSolve(12, 1.2);
+    BOOST_CHECK_EQUAL(reuse.extraTime(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(CheapSetupIsAlwaysRedone)
+{
+    Opm::AdaptiveSetupReuse reuse;
+    reuse.recordSetup(0.1);
+    reuse.recordUpdate(0.2);
+    BOOST_CHECK(reuse.shouldRecreate());
+}
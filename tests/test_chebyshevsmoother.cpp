@@ -0,0 +1,134 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#define BOOST_TEST_MODULE TestChebyshevSmoother
+
+#include <config.h>
+#include <opm/simulators/linalg/ChebyshevSmoother.hpp>
+
+#include <boost/mpl/list.hpp>
+#include <boost/test/unit_test.hpp>
+#include <dune/common/fmatrix.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+
+using NumericTypes = boost::mpl::list<double, float>;
+
+namespace {
+
+// Tridiagonal 1D Laplace matrix with Dirichlet boundaries, and 1x1 blocks.
+template <class T>
+Dune::BCRSMatrix<Dune::FieldMatrix<T, 1, 1>> laplace1D(const int N)
+{
+    using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<T, 1, 1>>;
+    Matrix A(N, N, 3 * N, Matrix::row_wise);
+    for (auto row = A.createbegin(); row != A.createend(); ++row) {
+        const int i = row.index();
+        if (i > 0) {
+            row.insert(i - 1);
+        }
+        row.insert(i);
+        if (i < N - 1) {
+            row.insert(i + 1);
+        }
+    }
+    for (int i = 0; i < N; ++i) {
+        A[i][i] = 2.0;
+        if (i > 0) {
+            A[i][i - 1] = -1.0;
+        }
+        if (i < N - 1) {
+            A[i][i + 1] = -1.0;
+        }
+    }
+    return A;
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(EigenvalueEstimate, T, NumericTypes)
+{
+    // The eigenvalues of D^-1 A for the 1D Laplacian are 1 - cos(k pi / (N + 1)),
+    // all below 2. The estimate includes a safety factor of 1.1.
+    const int N = 50;
+    using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<T, 1, 1>>;
+    using Vector = Dune::BlockVector<Dune::FieldVector<T, 1>>;
+    const Matrix A = laplace1D<T>(N);
+
+    Dune::ChebyshevSmoother<Matrix, Vector, Vector> smoother(A, 2, 30.0, 50);
+    const T lambda = smoother.largestEigenvalue();
+    BOOST_CHECK_GT(lambda, 1.5);
+    BOOST_CHECK_LE(lambda, 2.0 * 1.1 + 1e-4);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(SmoothingReducesHighFrequencyError, T, NumericTypes)
+{
+    const int N = 64;
+    using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<T, 1, 1>>;
+    using Vector = Dune::BlockVector<Dune::FieldVector<T, 1>>;
+    const Matrix A = laplace1D<T>(N);
+
+    // Oscillating error, with a zero right hand side the error is -x.
+    Vector x(N);
+    for (int i = 0; i < N; ++i) {
+        x[i] = (i % 2 == 0) ? 1.0 : -1.0;
+    }
+    const Vector b(N, 0.0);
+    const T initial = x.two_norm();
+
+    // Higher degrees damp the error more.
+    T previous = initial;
+    for (const int degree : {1, 2, 4}) {
+        Dune::ChebyshevSmoother<Matrix, Vector, Vector> smoother(A, degree);
+        Vector v = x;
+        smoother.apply(v, b);
+        BOOST_CHECK_LT(v.two_norm(), previous);
+        previous = v.two_norm();
+    }
+    BOOST_CHECK_LT(previous, 0.25 * initial);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ConvergesAsIteration, T, NumericTypes)
+{
+    const int N = 20;
+    using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<T, 1, 1>>;
+    using Vector = Dune::BlockVector<Dune::FieldVector<T, 1>>;
+    Matrix A = laplace1D<T>(N);
+    // Make the matrix strongly diagonally dominant for fast convergence.
+    for (int i = 0; i < N; ++i) {
+        A[i][i] = 4.0;
+    }
+
+    Vector b(N);
+    for (int i = 0; i < N; ++i) {
+        b[i] = 1.0 + i;
+    }
+
+    Dune::ChebyshevSmoother<Matrix, Vector, Vector> smoother(A, 3, 4.0);
+    Vector x(N, 0.0);
+    for (int it = 0; it < 30; ++it) {
+        smoother.apply(x, b);
+    }
+
+    Vector res = b;
+    A.mmv(x, res);
+    BOOST_CHECK_SMALL(res.two_norm() / b.two_norm(), T(1e-4));
+
+    // Updating with unchanged matrix gives the same estimate.
+    const T lambda = smoother.largestEigenvalue();
+    smoother.update();
+    BOOST_CHECK_CLOSE(smoother.largestEigenvalue(), lambda, 1e-4);
+}
@@ -50,6 +50,7 @@
 #include <opm/simulators/flow/FlowProblemBlackoil.hpp>
 #include <opm/simulators/flow/FlowProblemBlackoilProperties.hpp>
 #include <opm/simulators/flow/equil/EquilibrationHelpers.hpp>
+#include <opm/simulators/flow/equil/PressureTableCache.hpp>
 #include <opm/simulators/linalg/parallelbicgstabbackend.hh>
 #include <opm/simulators/wells/BlackoilWellModel.hpp>
 
@@ -62,9 +63,12 @@
 #include <array>
 #include <cstdlib>
 #include <cstring>
+#include <filesystem>
 #include <iostream>
 #include <memory>
 #include <numeric>
+#include <random>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -346,6 +350,80 @@ BOOST_AUTO_TEST_CASE(PhasePressure)
     BOOST_CHECK_CLOSE(ptable.oil  (last) , 166.5e3, reltol);
 }
 
+BOOST_AUTO_TEST_CASE(PressureTableRoundTrip)
+{
+    const auto record = mkEquilRecord( 0, 1e5, 5, 0, 0, 0 );
+
+    using TypeTag     = Opm::Properties::TTag::TestEquilTypeTag;
+    using FluidSystem = Opm::GetPropType<TypeTag, Opm::Properties::FluidSystem>;
+    using PTable      = Opm::EQUIL::Details::PressureTable<
+        FluidSystem, Opm::EQUIL::EquilReg<double>
+    >;
+
+    std::vector<double> x = {0.0,100.0};
+    std::vector<double> y = {0.0,0.0};
+    Opm::Tabulated1DFunction<double> trivialSaltVdTable{2,x,y};
+
+    std::vector<double> yT = {298.15,298.15};
+    Opm::Tabulated1DFunction<double> trivialTempVdTable{2, x, yT};
+
+    auto simulator = initSimulator<TypeTag>("equil_base.DATA");
+    initDefaultFluidSystem<TypeTag>();
+
+    using NoMix = Opm::EQUIL::Miscibility::NoMixing<double>;
+    const auto region = Opm::EQUIL::EquilReg<double> {
+        record,
+        std::make_shared<NoMix>(),
+        std::make_shared<NoMix>(),
+        std::make_shared<NoMix>(),
+        trivialTempVdTable,
+        trivialSaltVdTable,
+        0
+    };
+
+    const auto vspan = std::array<double, 2>{{ 0.0, 10.0 }};
+    const auto grav = 10.0;
+    auto ptable = PTable{ grav, 100 };
+    ptable.equilibrate(region, vspan);
+
+    std::stringstream ss;
+    ptable.write(ss);
+
+    auto restored = PTable{ grav, 100 };
+    BOOST_REQUIRE(restored.read(ss));
+
+    for (const auto depth : { 0.0, 1.7, 5.0, 6.3, 10.0 }) {
+        BOOST_CHECK_EQUAL(restored.water(depth), ptable.water(depth));
+        BOOST_CHECK_EQUAL(restored.oil(depth), ptable.oil(depth));
+    }
+
+    // Truncated data is rejected.
+    const auto data = ss.str();
+    std::stringstream truncated(data.substr(0, data.size() / 2));
+    auto incomplete = PTable{ grav, 100 };
+    BOOST_CHECK(!incomplete.read(truncated));
+}
+
+BOOST_AUTO_TEST_CASE(PressureTableCacheStore)
+{
+    const auto dir = std::filesystem::temp_directory_path()
+        / ("opm-equil-cache-" + std::to_string(std::random_device{}()));
+
+    const auto disabled = Opm::EQUIL::Details::PressureTableCache{};
+    BOOST_CHECK(!disabled.enabled());
+
+    const auto cache = Opm::EQUIL::Details::PressureTableCache{ dir.string() };
+    BOOST_CHECK(cache.enabled());
+    BOOST_CHECK(!cache.load(42).has_value());
+
+    const auto data = std::string { "table\0data", 10 };
+    BOOST_REQUIRE(cache.store(42, data));
+    BOOST_CHECK(cache.load(42) == data);
+    BOOST_CHECK(!cache.load(43).has_value());
+
+    std::filesystem::remove_all(dir);
+}
+
 BOOST_AUTO_TEST_CASE(CellSubset)
 {
     using PVal        = std::vector<double>;
@@ -0,0 +1,148 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE FlatIdMapTest
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/utils/FlatIdMap.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <unordered_map>
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+    const Opm::FlatIdMap<double> map;
+
+    BOOST_CHECK(map.empty());
+    BOOST_CHECK_EQUAL(map.size(), std::size_t{0});
+    BOOST_CHECK(map.begin() == map.end());
+    BOOST_CHECK(map.find(42) == map.end());
+    BOOST_CHECK_EQUAL(map.count(42), std::size_t{0});
+    BOOST_CHECK_THROW(map.at(42), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(InsertAndLookup)
+{
+    Opm::FlatIdMap<double> map;
+
+    const auto [it, inserted] = map.emplace(7, 1.0);
+    BOOST_CHECK(inserted);
+    BOOST_CHECK_EQUAL(it->first, std::uint64_t{7});
+    BOOST_CHECK_EQUAL(it->second, 1.0);
+
+    // emplace does not overwrite, insert_or_assign does.
+    BOOST_CHECK(!map.emplace(7, 2.0).second);
+    BOOST_CHECK_EQUAL(map.at(7), 1.0);
+    BOOST_CHECK(!map.insert_or_assign(7, 3.0).second);
+    BOOST_CHECK_EQUAL(map.at(7), 3.0);
+
+    map[8] += 4.0;
+    BOOST_CHECK_EQUAL(map.at(8), 4.0);
+    BOOST_CHECK_EQUAL(map.size(), std::size_t{2});
+
+    map.find(8)->second = 5.0;
+    BOOST_CHECK_EQUAL(map.at(8), 5.0);
+
+    map.clear();
+    BOOST_CHECK(map.empty());
+    BOOST_CHECK(map.find(7) == map.end());
+    BOOST_CHECK(map.begin() == map.end());
+}
+
+BOOST_AUTO_TEST_CASE(CompareWithUnorderedMap)
+{
+    Opm::FlatIdMap<double> map;
+    std::unordered_map<std::uint64_t, double> reference;
+
+    // Ids of neighbouring cells in a 20x20x20 grid, built like the
+    // transmissibility ids with the larger index in the upper bits.
+    const std::uint64_t n = 20;
+    for (std::uint64_t cell = 0; cell < n*n*n; ++cell) {
+        for (const std::uint64_t offset : {std::uint64_t{1}, n, n*n}) {
+            if (cell + offset < n*n*n) {
+                const std::uint64_t id = ((cell + offset) << 32) + cell;
+                const double value = 0.5 * cell + offset;
+                map.insert_or_assign(id, value);
+                reference.insert_or_assign(id, value);
+            }
+        }
+    }
+
+    BOOST_CHECK_EQUAL(map.size(), reference.size());
+    for (const auto& [id, value] : reference) {
+        BOOST_CHECK_EQUAL(map.at(id), value);
+    }
+
+    std::size_t count = 0;
+    for (const auto& [id, value] : map) {
+        BOOST_CHECK_EQUAL(reference.at(id), value);
+        ++count;
+    }
+    BOOST_CHECK_EQUAL(count, reference.size());
+    BOOST_CHECK_EQUAL(map.count(std::uint64_t{1} << 40), std::size_t{0});
+}
+
+BOOST_AUTO_TEST_CASE(ReserveAndCopy)
+{
+    Opm::FlatIdMap<double> map;
+    map.reserve(1000);
+    for (std::uint64_t id = 0; id < 1000; ++id) {
+        map.emplace(id, static_cast<double>(id));
+    }
+
+    const auto copy = map;
+    BOOST_CHECK(copy == map);
+
+    for (auto&& entry : map) {
+        entry.second = 0.0;
+    }
+    BOOST_CHECK(!(copy == map));
+    BOOST_CHECK_EQUAL(copy.at(999), 999.0);
+    BOOST_CHECK_EQUAL(map.at(999), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(EmplaceExistingKeyDoesNotGrow)
+{
+    // A full table of the minimum capacity
+    Opm::FlatIdMap<double> map;
+    for (std::uint64_t id = 0; id < 12; ++id) {
+        map.emplace(id, static_cast<double>(id));
+    }
+
+    const double* value = &map.at(5);
+    const auto [it, inserted] = map.emplace(5, 10.0);
+    BOOST_CHECK(!inserted);
+    BOOST_CHECK_EQUAL(&it->second, value);
+    BOOST_CHECK_EQUAL(&map.at(5), value);
+    BOOST_CHECK_EQUAL(map.at(5), 5.0);
+    BOOST_CHECK_EQUAL(map.size(), std::size_t{12});
+
+    map.insert_or_assign(5, 10.0);
+    BOOST_CHECK_EQUAL(&map.at(5), value);
+    BOOST_CHECK_EQUAL(map.at(5), 10.0);
+
+    map.emplace(12, 12.0);
+    BOOST_CHECK_EQUAL(map.size(), std::size_t{13});
+    for (std::uint64_t id = 0; id < 13; ++id) {
+        BOOST_CHECK_EQUAL(map.count(id), std::size_t{1});
+    }
+}
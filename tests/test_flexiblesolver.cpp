@@ -124,3 +124,55 @@ BOOST_AUTO_TEST_CASE(TestFlexibleSolver)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE(TestPipelinedBiCGSTAB)
+{
+    // The pipelined solver should converge to the same solution as
+    // the standard BiCGSTAB solver when solving to a tight tolerance.
+    // A fixed preconditioner is used, as both solvers assume that.
+    Opm::PropertyTree prm("options_flexiblesolver_3x3.json");
+    prm.put("preconditioner.type", std::string("jac"));
+    prm.put("tol", 1e-10);
+    prm.put("maxiter", 200);
+    prm.put("verbosity", 0);
+
+    const int bz = 3;
+    prm.put("solver", std::string("bicgstab"));
+    auto expected = testSolver<bz>(prm, "matr33.txt", "rhs3.txt");
+    prm.put("solver", std::string("pbicgstab"));
+    auto sol = testSolver<bz>(prm, "matr33.txt", "rhs3.txt");
+
+    BOOST_REQUIRE_EQUAL(sol.size(), expected.size());
+    const double scale = expected.infinity_norm();
+    for (size_t i = 0; i < sol.size(); ++i) {
+        for (int row = 0; row < bz; ++row) {
+            BOOST_CHECK_SMALL((sol[i][row] - expected[i][row]) / scale, 1e-6);
+        }
+    }
+}
+
+#if FLOW_INSTANTIATE_FLOAT
+BOOST_AUTO_TEST_CASE(TestMixedPrecisionCPR)
+{
+    // CPR run in float should give the same solution as CPR in double
+    // when the double precision Krylov solver solves to a tight tolerance.
+    Opm::PropertyTree prm("options_flexiblesolver_3x3.json");
+    prm.put("tol", 1e-10);
+    prm.put("maxiter", 200);
+    prm.put("verbosity", 0);
+    prm.put("preconditioner.verbosity", 0);
+
+    const int bz = 3;
+    auto expected = testSolver<bz>(prm, "matr33.txt", "rhs3.txt");
+    prm.put("preconditioner.type", std::string("cprfloat"));
+    auto sol = testSolver<bz>(prm, "matr33.txt", "rhs3.txt");
+
+    BOOST_REQUIRE_EQUAL(sol.size(), expected.size());
+    const double scale = expected.infinity_norm();
+    for (size_t i = 0; i < sol.size(); ++i) {
+        for (int row = 0; row < bz; ++row) {
+            BOOST_CHECK_SMALL((sol[i][row] - expected[i][row]) / scale, 1e-6);
+        }
+    }
+}
+#endif
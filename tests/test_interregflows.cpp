@@ -382,6 +382,91 @@ BOOST_AUTO_TEST_CASE(AllInternal)
     }
 }
 
+BOOST_AUTO_TEST_CASE(AllInternal_RegisteredConnections)
+{
+    auto flows = Opm::InterRegFlowMapSingleFIP{ left_right_split_region() };
+
+    BOOST_CHECK_MESSAGE(flows.registerConnection({ 0, 0, true }, { 1, 1, true }),
+                        "Connection 0->1 must contribute to inter-region flows");
+    BOOST_CHECK_MESSAGE(! flows.registerConnection({ 0, 0, true }, { 2, 2, true }),
+                        "Connection 0->2 must NOT contribute to inter-region flows");
+    BOOST_CHECK_MESSAGE(! flows.registerConnection({ 1, 1, true }, { 3, 3, true }),
+                        "Connection 1->3 must NOT contribute to inter-region flows");
+    BOOST_CHECK_MESSAGE(flows.registerConnection({ 2, 2, true }, { 3, 3, true }),
+                        "Connection 2->3 must contribute to inter-region flows");
+
+    BOOST_CHECK_MESSAGE(flows.isInterRegionConnection(0), "Connection 0 must be inter-region");
+    BOOST_CHECK_MESSAGE(! flows.isInterRegionConnection(1), "Connection 1 must NOT be inter-region");
+    BOOST_CHECK_MESSAGE(! flows.isInterRegionConnection(2), "Connection 2 must NOT be inter-region");
+    BOOST_CHECK_MESSAGE(flows.isInterRegionConnection(3), "Connection 3 must be inter-region");
+
+    // Rates added in reverse order, to check independence of order.
+    flows.addConnection(3, conn_23());
+    flows.addConnection(2, conn_13());
+    flows.addConnection(1, conn_02());
+    flows.addConnection(0, conn_01());
+
+    flows.compress();
+
+    const auto& iregFlows = flows.getInterRegFlows();
+    BOOST_CHECK_EQUAL(iregFlows.numRegions(), 2);
+
+    const auto q12 = iregFlows.getInterRegFlows(0, 1);
+    BOOST_REQUIRE_MESSAGE(q12.has_value(),
+                          "There must be inter-region flows "
+                          "between regions 1 and 2");
+
+    const auto& [rate, sign] = q12.value();
+
+    BOOST_CHECK_EQUAL(sign, 1.0);
+
+    using FlowView = std::remove_cv_t<std::remove_reference_t<
+        decltype(rate)>>;
+
+    using Component = FlowView::Component;
+    using Direction = FlowView::Direction;
+
+    BOOST_CHECK_CLOSE(rate.flow(Component::Oil), 0.88f, 1.0e-6);
+    BOOST_CHECK_CLOSE(rate.flow(Component::Gas), 1.76f, 1.0e-6);
+    BOOST_CHECK_CLOSE(rate.flow(Component::Water), 2.64f, 1.0e-5);
+    BOOST_CHECK_CLOSE(rate.flow(Component::Disgas), 3.52f, 1.0e-6);
+    BOOST_CHECK_CLOSE(rate.flow(Component::Vapoil), 3.75f, 1.0e-6);
+
+    BOOST_CHECK_CLOSE(rate.flow(Component::Oil, Direction::Positive), 1.0f, 1.0e-6);
+    BOOST_CHECK_CLOSE(rate.flow(Component::Gas, Direction::Positive), 2.0f, 1.0e-6);
+    BOOST_CHECK_CLOSE(rate.flow(Component::Water, Direction::Positive), 3.0f, 1.0e-6);
+    BOOST_CHECK_CLOSE(rate.flow(Component::Disgas, Direction::Positive), 4.0f, 1.0e-6);
+    BOOST_CHECK_CLOSE(rate.flow(Component::Vapoil, Direction::Positive), 5.0f, 1.0e-6);
+
+    BOOST_CHECK_CLOSE(rate.flow(Component::Oil, Direction::Negative), -0.12f, 1.0e-6);
+    BOOST_CHECK_CLOSE(rate.flow(Component::Gas, Direction::Negative), -0.24f, 1.0e-6);
+    BOOST_CHECK_CLOSE(rate.flow(Component::Water, Direction::Negative), -0.36f, 1.0e-6);
+    BOOST_CHECK_CLOSE(rate.flow(Component::Disgas, Direction::Negative), -0.48f, 1.0e-6);
+    BOOST_CHECK_CLOSE(rate.flow(Component::Vapoil, Direction::Negative), -1.25f, 1.0e-6);
+
+    // Clearing the map resets the flow rates, but keeps the registered
+    // connections.
+    flows.clear();
+    BOOST_CHECK_MESSAGE(flows.isInterRegionConnection(0),
+                        "Connection 0 must be inter-region after clear()");
+    BOOST_CHECK_MESSAGE(! flows.isInterRegionConnection(1),
+                        "Connection 1 must NOT be inter-region after clear()");
+
+    flows.addConnection(0, conn_01());
+    flows.compress();
+
+    const auto q12_clear = flows.getInterRegFlows().getInterRegFlows(0, 1);
+    BOOST_REQUIRE_MESSAGE(q12_clear.has_value(),
+                          "There must be inter-region flows "
+                          "between regions 1 and 2 after clear()");
+
+    const auto& [rate_clear, sign_clear] = q12_clear.value();
+
+    BOOST_CHECK_EQUAL(sign_clear, 1.0);
+    BOOST_CHECK_CLOSE(rate_clear.flow(Component::Oil), 1.0f, 1.0e-6);
+    BOOST_CHECK_CLOSE(rate_clear.flow(Component::Vapoil), 5.0f, 1.0e-6);
+}
+
 BOOST_AUTO_TEST_CASE(LeftInternal_RightOther)
 {
     auto flows = Opm::InterRegFlowMapSingleFIP{ left_right_split_region() };
@@ -199,3 +199,42 @@ BOOST_AUTO_TEST_CASE(MILULaplace4)
 {
     test<4>();
 }
+
+template<int bsize>
+void test_multithreaded(Opm::MILU_VARIANT milu, int n)
+{
+    using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<double, bsize, bsize>>;
+    using Vector = Dune::BlockVector<Dune::FieldVector<double, bsize>>;
+    using ILU = Opm::ParallelOverlappingILU0<Matrix, Vector, Vector, Dune::Amg::SequentialInformation>;
+
+    std::size_t N = 32;
+    Matrix A;
+    setupLaplacian(A, N);
+    // The level scheduled version has to give the same result as the serial one
+    ILU serial(A, n, 1.0, milu, false, true, false);
+    ILU threaded(A, n, 1.0, milu, false, true, true);
+
+    Vector d(A.N()), v1(A.N()), v2(A.N());
+    for (std::size_t i = 0; i < d.size(); ++i) {
+        d[i] = 1.0 + 0.1 * (i % 7);
+    }
+    v1 = 0;
+    v2 = 0;
+    auto d1 = d;
+    auto d2 = d;
+    serial.apply(v1, d1);
+    threaded.apply(v2, d2);
+    for (std::size_t i = 0; i < v1.size(); ++i) {
+        for (int j = 0; j < bsize; ++j) {
+            BOOST_CHECK_CLOSE(v1[i][j], v2[i][j], 1e-12);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ILU0Multithreaded)
+{
+    test_multithreaded<1>(Opm::MILU_VARIANT::ILU, 0);
+    test_multithreaded<3>(Opm::MILU_VARIANT::ILU, 0);
+    test_multithreaded<3>(Opm::MILU_VARIANT::MILU_1, 0);
+    test_multithreaded<3>(Opm::MILU_VARIANT::ILU, 1);
+}
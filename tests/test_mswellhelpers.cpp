@@ -0,0 +1,150 @@
+/*
+  This file is part of the Open Porous Media Project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE MSWellHelpersTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/wells/MSWellHelpers.hpp>
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+using Block = Dune::FieldMatrix<double, 3, 3>;
+using Matrix = Dune::BCRSMatrix<Block>;
+using Vector = Dune::BlockVector<Dune::FieldVector<double, 3>>;
+
+// Segment matrix with the sparsity pattern given by the outlets, and
+// diagonally dominant blocks.
+Matrix makeSegmentMatrix(const std::vector<int>& outlets)
+{
+    const int num_seg = outlets.size();
+    Matrix D(num_seg, num_seg, Matrix::random);
+    for (int seg = 0; seg < num_seg; ++seg) {
+        int num_inlets = 0;
+        for (const int outlet : outlets) {
+            num_inlets += outlet == seg;
+        }
+        D.setrowsize(seg, 1 + (outlets[seg] >= 0) + num_inlets);
+    }
+    D.endrowsizes();
+    for (int seg = 0; seg < num_seg; ++seg) {
+        D.addindex(seg, seg);
+        if (outlets[seg] >= 0) {
+            D.addindex(seg, outlets[seg]);
+            D.addindex(outlets[seg], seg);
+        }
+    }
+    D.endindices();
+
+    for (auto row = D.begin(); row != D.end(); ++row) {
+        for (auto col = row->begin(); col != row->end(); ++col) {
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    (*col)[i][j] = 0.1 * (1 + row.index() + 2 * col.index() + i - j);
+                }
+                if (row.index() == col.index()) {
+                    (*col)[i][i] += 10.0;
+                }
+            }
+        }
+    }
+    return D;
+}
+
+void checkSolve(const std::vector<int>& outlets)
+{
+    const Matrix D = makeSegmentMatrix(outlets);
+
+    Opm::mswellhelpers::SegmentTreeSolver<Matrix, Vector> solver;
+    solver.analyse(outlets);
+    BOOST_CHECK(!solver.isFactorized());
+    BOOST_CHECK(solver.factorize(D));
+    BOOST_CHECK(solver.isFactorized());
+
+    Vector rhs(outlets.size());
+    for (std::size_t seg = 0; seg < rhs.size(); ++seg) {
+        for (int i = 0; i < 3; ++i) {
+            rhs[seg][i] = 1.0 + seg - i;
+        }
+    }
+
+    const Vector x = solver.solve(rhs);
+    Vector Dx(rhs.size());
+    D.mv(x, Dx);
+    for (std::size_t seg = 0; seg < rhs.size(); ++seg) {
+        for (int i = 0; i < 3; ++i) {
+            BOOST_CHECK_CLOSE(Dx[seg][i], rhs[seg][i], 1e-10);
+        }
+    }
+
+    // D * D^-1 = I
+    const auto inv = solver.inverse();
+    const int num_seg = outlets.size();
+    for (int r = 0; r < num_seg; ++r) {
+        for (int c = 0; c < num_seg; ++c) {
+            Block prod(0.0);
+            for (auto col = D[r].begin(); col != D[r].end(); ++col) {
+                Block tmp = *col;
+                tmp.rightmultiply(inv[col.index()][c]);
+                prod += tmp;
+            }
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    BOOST_CHECK_SMALL(prod[i][j] - (r == c && i == j ? 1.0 : 0.0), 1e-10);
+                }
+            }
+        }
+    }
+
+    solver.clear();
+    BOOST_CHECK(!solver.isFactorized());
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(UnbranchedWell)
+{
+    checkSolve({-1, 0, 1, 2, 3, 4, 5});
+}
+
+BOOST_AUTO_TEST_CASE(BranchedWell)
+{
+    // Two lateral branches joining the main stem, segments not in order.
+    checkSolve({-1, 0, 1, 2, 1, 4, 5, 2, 7, 8});
+    checkSolve({3, 0, 1, -1, 2, 4, 3});
+}
+
+BOOST_AUTO_TEST_CASE(SingularBlock)
+{
+    const std::vector<int> outlets {-1, 0, 1};
+    Matrix D = makeSegmentMatrix(outlets);
+    D[2][2] = 0.0;
+
+    Opm::mswellhelpers::SegmentTreeSolver<Matrix, Vector> solver;
+    solver.analyse(outlets);
+    BOOST_CHECK(!solver.factorize(D));
+    BOOST_CHECK(!solver.isFactorized());
+}
@@ -0,0 +1,148 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#define BOOST_TEST_MODULE TestRecyclingGCRSolver
+
+#include <config.h>
+#include <opm/simulators/linalg/RecyclingGCRSolver.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <dune/common/fmatrix.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+#include <dune/istl/operators.hh>
+#include <dune/istl/preconditioners.hh>
+#include <dune/istl/scalarproducts.hh>
+
+#include <cmath>
+
+namespace {
+
+using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<double, 1, 1>>;
+using Vector = Dune::BlockVector<Dune::FieldVector<double, 1>>;
+
+// Tridiagonal 1D convection-diffusion matrix, which converges slowly
+// with a Jacobi preconditioner.
+Matrix convectionDiffusion1D(const int N)
+{
+    Matrix A(N, N, 3 * N, Matrix::row_wise);
+    for (auto row = A.createbegin(); row != A.createend(); ++row) {
+        const int i = row.index();
+        if (i > 0) {
+            row.insert(i - 1);
+        }
+        row.insert(i);
+        if (i < N - 1) {
+            row.insert(i + 1);
+        }
+    }
+    for (int i = 0; i < N; ++i) {
+        A[i][i] = 2.0;
+        if (i > 0) {
+            A[i][i - 1] = -1.2;
+        }
+        if (i < N - 1) {
+            A[i][i + 1] = -0.8;
+        }
+    }
+    return A;
+}
+
+Vector rhs(const int N, const double frequency)
+{
+    Vector b(N);
+    for (int i = 0; i < N; ++i) {
+        b[i] = std::sin(frequency * i) + 1.0;
+    }
+    return b;
+}
+
+double relativeDefect(const Matrix& A, const Vector& x, const Vector& b)
+{
+    Vector r = b;
+    A.mmv(x, r);
+    return r.two_norm() / b.two_norm();
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(RecycledSpaceReducesIterations)
+{
+    const int N = 100;
+    const Matrix A = convectionDiffusion1D(N);
+    Dune::MatrixAdapter<Matrix, Vector, Vector> op(A);
+    Dune::SeqScalarProduct<Vector> sp;
+    Dune::SeqJac<Matrix, Vector, Vector> prec(A, 1, 1.0);
+
+    // Solve a second, related system with and without the space
+    // recycled from a first solve.
+    Dune::RecyclingGCRSolver<Vector> fresh(op, sp, prec, 1e-8, 15, 5, 1000, 0);
+    Dune::RecyclingGCRSolver<Vector> recycling(op, sp, prec, 1e-8, 15, 5, 1000, 0);
+    BOOST_CHECK_EQUAL(recycling.recycledSize(), 0);
+
+    {
+        const Vector b0 = rhs(N, 0.1);
+        Vector b = b0;
+        Vector x(N);
+        x = 0.0;
+        Dune::InverseOperatorResult res;
+        recycling.apply(x, b, res);
+        BOOST_CHECK(res.converged);
+        BOOST_CHECK_LT(relativeDefect(A, x, b0), 1e-7);
+        BOOST_CHECK_EQUAL(recycling.recycledSize(), 5);
+    }
+
+    const Vector b0 = rhs(N, 0.11);
+    Dune::InverseOperatorResult resFresh;
+    {
+        Vector b = b0;
+        Vector x(N);
+        x = 0.0;
+        fresh.apply(x, b, resFresh);
+        BOOST_CHECK(resFresh.converged);
+        BOOST_CHECK_LT(relativeDefect(A, x, b0), 1e-7);
+    }
+    Dune::InverseOperatorResult resRecycled;
+    {
+        Vector b = b0;
+        Vector x(N);
+        x = 0.0;
+        recycling.apply(x, b, resRecycled);
+        BOOST_CHECK(resRecycled.converged);
+        BOOST_CHECK_LT(relativeDefect(A, x, b0), 1e-7);
+    }
+    BOOST_CHECK_LT(resRecycled.iterations, resFresh.iterations);
+}
+
+BOOST_AUTO_TEST_CASE(NoRecycling)
+{
+    const int N = 100;
+    const Matrix A = convectionDiffusion1D(N);
+    Dune::MatrixAdapter<Matrix, Vector, Vector> op(A);
+    Dune::SeqScalarProduct<Vector> sp;
+    Dune::SeqJac<Matrix, Vector, Vector> prec(A, 1, 1.0);
+
+    Dune::RecyclingGCRSolver<Vector> solver(op, sp, prec, 1e-8, 15, 0, 1000, 0);
+    const Vector b0 = rhs(N, 0.1);
+    Vector b = b0;
+    Vector x(N);
+    x = 0.0;
+    Dune::InverseOperatorResult res;
+    solver.apply(x, b, res);
+    BOOST_CHECK(res.converged);
+    BOOST_CHECK_LT(relativeDefect(A, x, b0), 1e-7);
+    BOOST_CHECK_EQUAL(solver.recycledSize(), 0);
+}
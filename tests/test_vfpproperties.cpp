@@ -28,6 +28,7 @@
 #include <map>
 #include <sstream>
 #include <limits>
+#include <utility>
 #include <vector>
 
 #include <opm/common/utility/platform_dependent/disable_warnings.h>
@@ -100,6 +101,45 @@ BOOST_AUTO_TEST_CASE(findInterpData)
     BOOST_CHECK_EQUAL(eval5.factor_, 1.0);
 }
 
+BOOST_AUTO_TEST_CASE(findInterpDataHint)
+{
+    std::vector<double> values = {1, 5, 7, 7, 9, 11, 15};
+
+    // Values with the lower index of the interval they belong to. A value
+    // equal to an internal table value belongs to the interval left of it.
+    const std::vector<std::pair<double, int>> expected = {
+        {0.5, 0}, {1.0, 0}, {3.0, 0}, {5.0, 0}, {6.0, 1}, {7.0, 1},
+        {8.0, 3}, {9.0, 3}, {10.0, 4}, {11.0, 4}, {13.0, 5}, {15.0, 5},
+        {19.0, 5},
+    };
+
+    // Any starting hint, including stale and out of range hints, must give
+    // the same intervals when sweeping the values up and down.
+    for (int start = -1; start < 8; ++start) {
+        int hint = start;
+        for (const auto& [value, ind] : expected) {
+            auto eval = Opm::VFPHelpers<double>::findInterpData(value, values, hint);
+            BOOST_CHECK_EQUAL(eval.ind_[0], ind);
+            BOOST_CHECK_EQUAL(eval.ind_[1], ind + 1);
+            BOOST_CHECK_EQUAL(hint, ind);
+        }
+        for (auto it = expected.rbegin(); it != expected.rend(); ++it) {
+            auto eval = Opm::VFPHelpers<double>::findInterpData(it->first, values, hint);
+            BOOST_CHECK_EQUAL(eval.ind_[0], it->second);
+            BOOST_CHECK_EQUAL(eval.ind_[1], it->second + 1);
+            BOOST_CHECK_EQUAL(hint, it->second);
+        }
+    }
+
+    int hint = 4;
+    auto eval0 = Opm::VFPHelpers<double>::findInterpData(6.0, values, hint);
+    BOOST_CHECK_EQUAL(eval0.factor_, 0.5);
+    auto eval1 = Opm::VFPHelpers<double>::findInterpData(19.0, values, hint);
+    BOOST_CHECK_EQUAL(eval1.factor_, 2.0);
+    auto eval2 = Opm::VFPHelpers<double>::findInterpData(10.0, values, hint);
+    BOOST_CHECK_EQUAL(eval2.factor_, 0.5);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // HelperTests
 
 
@@ -571,6 +611,34 @@ BOOST_AUTO_TEST_CASE(ExplicitBhpLookup)
     BOOST_CHECK_CLOSE(bhp_val, bhp_val_explicit, max_d_tol);
 }
 
+/**
+ * Test that a bhp lookup starting from the intervals of the previous
+ * lookup gives the same result as a lookup without a hint, both when
+ * the rates drift slowly and when they jump across the table.
+ */
+BOOST_AUTO_TEST_CASE(HintedBhpLookup)
+{
+    fillDataRandom();
+    initProperties();
+
+    Opm::detail::VFPInterpHint hint{};
+    for (int i = 0; i < 200; ++i) {
+        // Slow drift, with a jump to the other end of the table every 17 steps
+        const double s = (i % 17 == 0) ? 1.0 - (i % 7) / 6.0 : (i % 40) / 40.0;
+        const double aqua = -0.3 * s;
+        const double liquid = -1.2 * s;
+        const double vapour = -0.4 * (1.0 - s);
+        const double thp = 1.1 * s;
+        const double alq = 0.9 * (1.0 - s);
+
+        const double bhp_hinted = properties->bhp(1, aqua, liquid, vapour, thp, alq,
+                                                  0, 0, false, &hint);
+        const double bhp_plain = properties->bhp(1, aqua, liquid, vapour, thp, alq,
+                                                 0, 0, false);
+        BOOST_CHECK_EQUAL(bhp_hinted, bhp_plain);
+    }
+}
+
 
 BOOST_AUTO_TEST_SUITE_END() // Trivial tests
 